@@ -111,6 +111,101 @@ class PID {
    */
   Constants constants_get();
 
+  /**
+   * Struct for feedforward constants, in output units (ie. -127 to 127).
+   */
+  struct Feedforward {
+    double kS = 0;  // static friction, added in the direction of velocity
+    double kV = 0;  // per unit of velocity
+    double kA = 0;  // per unit of acceleration
+  };
+
+  /**
+   * Set feedforward constants.  These are only used by feedforward_compute(), compute() stays
+   * pure feedback, so a PID without a profiled setpoint behaves the same.
+   *
+   * \param kS
+   *        output that overcomes static friction
+   * \param kV
+   *        output per unit of setpoint velocity
+   * \param kA
+   *        output per unit of setpoint acceleration
+   */
+  void feedforward_set(double kS, double kV = 0, double kA = 0);
+
+  /**
+   * Returns feedforward constants.
+   */
+  Feedforward feedforward_get();
+
+  /**
+   * Output needed to follow a setpoint moving at this velocity and acceleration.  Add it to
+   * compute().
+   *
+   * \param velocity
+   *        setpoint velocity, units per second
+   * \param acceleration
+   *        setpoint acceleration, units per second squared
+   */
+  double feedforward_compute(double velocity, double acceleration);
+
+  /**
+   * What a gain schedule is looked up by.
+   */
+  enum ScheduleKey {
+    SCHEDULE_ERROR,  // |target - current|
+    SCHEDULE_SPEED   // max speed of the motion, 0 to 127
+  };
+
+  /**
+   * One row of a gain schedule, the gains to use at this error or speed.
+   */
+  struct GainPoint {
+    double at;
+    double kp;
+    double ki;
+    double kd;
+  };
+
+  /**
+   * Sets a gain schedule, up to 6 rows in any order.  gains_schedule_update() interpolates kp, ki
+   * and kd between the rows either side of the error or speed, and holds the first and last row
+   * past the ends.  start_i is left alone.  An empty list removes the schedule and puts
+   * constants_set()'s gains back.
+   *
+   * \param key
+   *        PID::SCHEDULE_ERROR or PID::SCHEDULE_SPEED
+   * \param points
+   *        rows, ie. {{10, 8, 0, 50}, {90, 6, 0, 60}}
+   */
+  void gains_schedule_set(ScheduleKey key, std::initializer_list<GainPoint> points);
+
+  /**
+   * Returns true if there's a gain schedule.
+   */
+  bool gains_scheduled();
+
+  /**
+   * Turns the gain schedule off without forgetting it, or back on.  Turning it off puts
+   * constants_set()'s gains back, and while it's off gains_scheduled() is false and constants
+   * are left alone.
+   *
+   * \param enabled
+   *        true uses the schedule, false uses constants_set()'s
+   */
+  void gains_schedule_toggle(bool enabled);
+
+  /**
+   * Sets constants from the gain schedule, if there is one.  Call it before compute().  The
+   * gains it replaces are kept, and constants_set() while a schedule is running replaces those.
+   *
+   * \param error
+   *        target - current, for SCHEDULE_ERROR
+   * \param speed
+   *        max speed of the motion, for SCHEDULE_SPEED
+   */
+  void gains_schedule_update(double error, double speed);
+
   /**
    * Resets all variables to 0.  This does not reset constants.
    */
@@ -154,6 +249,46 @@ class PID {
    */
   ez::exit_output exit_condition(std::vector<pros::Motor> sensor, bool print = false);
 
+  /**
+   * Iterative exit condition for PID.  Doesn't copy the motors or allocate.
+   *
+   * \param sensors
+   *        Pointer to the first pros motor on your mechanism.
+   * \param count
+   *        Number of motors.
+   * \param print = false
+   *        if true, prints when complete.
+   */
+  ez::exit_output exit_condition(const pros::Motor* sensors, std::size_t count, bool print = false);
+
+  /**
+   * Iterative exit condition for PID.  Doesn't copy the motors or allocate.
+   *
+   * \param first
+   *        Iterator to the first motor in a contiguous range (ie. a std::vector or std::array).
+   * \param last
+   *        Iterator past the last motor.
+   * \param print = false
+   *        if true, prints when complete.
+   */
+  template <class Iterator>
+  ez::exit_output exit_condition(Iterator first, Iterator last, bool print = false) {
+    return exit_condition(&*first, std::distance(first, last), print);
+  }
+
+  /**
+   * Iterative exit condition for PID.  Doesn't copy the motors or allocate.
+   *
+   * \param sensors
+   *        Fixed size array of pros motors on your mechanism.
+   * \param print = false
+   *        if true, prints when complete.
+   */
+  template <std::size_t N>
+  ez::exit_output exit_condition(const std::array<pros::Motor, N>& sensors, bool print = false) {
+    return exit_condition(sensors.data(), N, print);
+  }
+
   /**
    * Sets the name of the PID that prints during exit conditions.
    *
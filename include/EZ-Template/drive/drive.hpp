@@ -20,7 +20,25 @@ file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 using namespace ez;
 
+struct PathProfile;
+
 namespace ez {
+/**
+ * What pid_turn_autotune() or pid_drive_autotune() found.  Overshoot is degrees or inches past
+ * the target, settle times are ms, and the before and after runs make the same moves.
+ */
+struct autotune_result {
+  double ultimate_gain;  // Ku from the relay test, output per degree or inch, 0 if it didn't oscillate
+  int ultimate_period;   // Tu from the relay test, ms
+  PID::Constants before;
+  PID::Constants after;
+  int settle_before;
+  int settle_after;
+  double overshoot_before;
+  double overshoot_after;
+  bool kept;  // after replaced before
+};
+
 class Drive {
  public:
   /**
@@ -233,6 +251,13 @@ class Drive {
    */
   pros::Task ez_auto;
 
+  /**
+   * One pass of ez_auto's loop.  The link sends ez_auto_task() to a loop of this (--wrap in the
+   * Makefile), which moves a running odometry motion's targets, applies the thermal speed cap
+   * and then computes the PIDs, in that order, in the one task.
+   */
+  void drive_task_step();
+
   /**
    * Creates a Drive Controller using internal encoders.
    *
@@ -653,6 +678,56 @@ class Drive {
    */
   double drive_imu_get();
 
+  /**
+   * Returns the heading with the IMU and the drive encoders fused, a drop in for
+   * drive_imu_get().  A small Kalman filter (okapi::EKFFilter) on the odometry task carries the
+   * heading from step to step with the encoders and lets the IMU pull it back so it can't
+   * drift.  IMU noise is smoothed without lag, and impact spikes are thrown out.  This is
+   * drive_imu_get() until odom_enable() starts the task.
+   */
+  double drive_heading_get();
+
+  /**
+   * Sets how much drive_heading_get() trusts each sensor, as standard deviations in degrees.
+   * Bigger IMU noise smooths more but leans on the encoders for longer.  Defaults to 0.2 and
+   * 0.08.
+   *
+   * \param imu_noise
+   *        of each IMU reading
+   * \param encoder_noise
+   *        of the encoders' heading change between IMU readings, 10ms apart
+   */
+  void drive_heading_noise_set(double imu_noise, double encoder_noise);
+
+  /**
+   * Sets the track width drive_heading_get() turns encoder travel into heading with, center to
+   * center of the wheels.  Wheel scrub is learned while turning, so this only has to be close.
+   * Defaults to 11.5.
+   *
+   * \param width
+   *        inches
+   */
+  void drive_heading_track_width_set(double width);
+
+  /**
+   * Starts drive_heading_get() over from the IMU's reading.  drive_imu_reset() and
+   * drive_angle_set() already call this, call it after setting the IMU any other way.
+   */
+  void drive_heading_resync();
+
+  /**
+   * Runs one step of drive_heading_get()'s filter.  The odometry task calls this every 5ms.
+   * Returns true if this step was a resync, then the heading jumped to the IMU's.
+   *
+   * \param left_delta
+   *        inches the left side moved since the last step
+   * \param right_delta
+   *        inches the right side moved since the last step
+   * \param imu
+   *        drive_imu_get()
+   */
+  bool drive_heading_step(double left_delta, double right_delta, double imu);
+
   /**
    * Calibrates the IMU, recommended to run in initialize().
    *
@@ -724,6 +799,92 @@ class Drive {
    */
   void pid_drive_set(double target, int speed, bool slew_on = false, bool toggle_heading = true);
 
+  /**
+   * Sets the robot to move forward along a jerk limited (S-curve) motion profile, with okapi
+   * units.  The PID targets follow the profile every 10ms instead of jumping to the end, so the
+   * robot speeds up and slows down within pid_drive_profile_constraints and arrives without
+   * blowing through the exit window.  With pid_drive_feedforward_set() the profile's velocity
+   * and acceleration are fed forward on top of PID, so the robot doesn't trail the targets.
+   * Wait with pid_wait(), it doesn't check the exit conditions until the profile has
+   * finished.
+   *
+   * \param target
+   *        target value in inches
+   * \param speed
+   *        0 to 127, max speed during motion.  the profile cruises at this fraction of max_velocity
+   * \param toggle_heading
+   *        toggle for heading correction
+   */
+  void pid_drive_profiled_set(okapi::QLength p_target, int speed, bool toggle_heading = true);
+
+  /**
+   * Sets the robot to move forward along a jerk limited (S-curve) motion profile, without okapi
+   * units.  See pid_drive_profiled_set(okapi::QLength, int, bool).
+   *
+   * \param target
+   *        target value as a double, unit is inches
+   * \param speed
+   *        0 to 127, max speed during motion.  the profile cruises at this fraction of max_velocity
+   * \param toggle_heading
+   *        toggle for heading correction
+   */
+  void pid_drive_profiled_set(double target, int speed, bool toggle_heading = true);
+
+  /**
+   * Sets the limits for profiled drive motions going forward.
+   *
+   * \param max_velocity
+   *        inches per second at a speed of 127.  keep this a little under the drive's top speed so PID has room to catch up
+   * \param max_acceleration
+   *        inches per second squared, speeding up and slowing down
+   * \param max_jerk
+   *        inches per second cubed, how fast acceleration can change
+   */
+  void pid_drive_profile_constraints_forward_set(double max_velocity, double max_acceleration, double max_jerk);
+
+  /**
+   * Sets the limits for profiled drive motions going backward.
+   *
+   * \param max_velocity
+   *        inches per second at a speed of 127.  keep this a little under the drive's top speed so PID has room to catch up
+   * \param max_acceleration
+   *        inches per second squared, speeding up and slowing down
+   * \param max_jerk
+   *        inches per second cubed, how fast acceleration can change
+   */
+  void pid_drive_profile_constraints_backward_set(double max_velocity, double max_acceleration, double max_jerk);
+
+  /**
+   * Sets the limits for profiled drive motions going forward and backward.
+   *
+   * \param max_velocity
+   *        inches per second at a speed of 127.  keep this a little under the drive's top speed so PID has room to catch up
+   * \param max_acceleration
+   *        inches per second squared, speeding up and slowing down
+   * \param max_jerk
+   *        inches per second cubed, how fast acceleration can change
+   */
+  void pid_drive_profile_constraints_set(double max_velocity, double max_acceleration, double max_jerk);
+
+  /**
+   * True while a pid_drive_profiled_set() is still moving its targets.
+   */
+  bool pid_drive_profile_running();
+
+  /**
+   * Where a running pid_drive_profiled_set() ends, since its PID targets move.
+   *
+   * \param targets
+   *        left and right targets, written if a profile is running
+   */
+  bool pid_drive_profile_final_get(double* targets);
+
+  /**
+   * Moves the targets of a running pid_drive_profiled_set() to where the profile is now.  This
+   * never blocks, the drive task calls it every 10ms before the PIDs compute.
+   */
+  void pid_drive_profile_step();
+
   /**
    * Sets the robot to turn using PID.
    *
@@ -844,10 +1005,185 @@ class Drive {
   void drive_angle_set(double angle);
 
   /**
-   * Lock the code in a while loop until the robot has settled.
+   * Lock the code in a while loop until the robot has settled.  The linker sends this to
+   * pid_wait_no_alloc() (--wrap in the Makefile), so nothing is allocated while waiting.
    */
   void pid_wait();
 
+  /**
+   * Lock the code in a while loop until the robot has settled.  Same exits as the library's
+   * pid_wait(), but checks the motors in place so nothing is allocated while waiting.  This is
+   * what pid_wait() runs.
+   */
+  void pid_wait_no_alloc();
+
+  /**
+   * Runs an action once the current motion has traveled this far from where it started.  Call it
+   * right after the pid_drive_set / pid_turn_set / pid_swing_set it belongs to.  Actions run from
+   * their own task every 10ms, so they must not block.  If another motion starts before the
+   * milestone is reached the action runs then, so a mechanism is never skipped.
+   *
+   * \param distance
+   *        inches traveled, average of both sides, using okapi units
+   * \param action
+   *        function to run, ie. [] { wingControl(true); }
+   */
+  void pid_action_distance_add(okapi::QLength distance, std::function<void()> action);
+
+  /**
+   * Runs an action once the current motion has traveled this far from where it started.
+   *
+   * \param distance
+   *        inches traveled, average of both sides
+   * \param action
+   *        function to run, ie. [] { wingControl(true); }
+   */
+  void pid_action_distance_add(double distance, std::function<void()> action);
+
+  /**
+   * Runs an action once the heading has changed this much since the motion started, using okapi units.
+   *
+   * \param angle
+   *        degrees turned in either direction, using okapi units
+   * \param action
+   *        function to run
+   */
+  void pid_action_angle_add(okapi::QAngle angle, std::function<void()> action);
+
+  /**
+   * Runs an action once the heading has changed this much since the motion started.
+   *
+   * \param angle
+   *        degrees turned in either direction
+   * \param action
+   *        function to run
+   */
+  void pid_action_angle_add(double angle, std::function<void()> action);
+
+  /**
+   * Runs an action once the current motion is this far to its target.
+   *
+   * \param fraction
+   *        0 to 1, ie. 0.9 runs the action 90% of the way through a turn
+   * \param action
+   *        function to run
+   */
+  void pid_action_progress_add(double fraction, std::function<void()> action);
+
+  /**
+   * Drops every action that hasn't run yet.
+   */
+  void pid_actions_clear();
+
+  /**
+   * Returns the number of actions that haven't run yet.
+   */
+  int pid_actions_pending();
+
+  /**
+   * Runs every action whose milestone was reached.  This never blocks, the actions task calls it
+   * every 10ms.
+   */
+  void pid_actions_step();
+
+  /**
+   * Starts / stops odometry.  The first call starts a task that integrates the drive sensors
+   * and the IMU every 5ms.  This uses drive_sensor_left() / drive_sensor_right(), so it follows
+   * trackers or rotation sensors if the Drive was made with them.
+   *
+   * \param input
+   *        true tracks the pose, false pauses it
+   */
+  void odom_enable(bool input);
+
+  /**
+   * Returns true if odometry is running.
+   */
+  bool odom_enabled();
+
+  /**
+   * Returns the current pose.  This never blocks and is safe to call from any task.
+   */
+  pose odom_pose_get();
+
+  /**
+   * Sets the current pose.  Call this after drive_sensor_reset() / drive_imu_reset() at the
+   * start of a routine.  The odometry task picks it up on its next step.
+   *
+   * \param input
+   *        new pose, inches and degrees
+   */
+  void odom_pose_set(pose input);
+
+  /**
+   * Turns to face a point on the field.  This is a pid_turn_set() to the angle odometry says the
+   * point is at, so pid_wait() and pid_wait_until() work the same.
+   *
+   * \param x
+   *        inches, in the odom_pose_get() frame
+   * \param y
+   *        inches, in the odom_pose_get() frame
+   * \param speed
+   *        0 to 127, max speed during motion
+   * \param slew_on
+   *        ramp up from slew_min to speed over slew_distance.  only use when you're going over about 14"
+   */
+  void pid_turn_to_point(double x, double y, int speed, bool slew_on = false);
+
+  /**
+   * Drives to a point on the field.  This is a pid_drive_set() whose target and heading are
+   * updated from odometry every 5ms, so pid_wait() and the drive exit conditions work the same.
+   * Points behind the robot are driven to backwards.  Odometry must be enabled.
+   *
+   * \param x
+   *        inches, in the odom_pose_get() frame
+   * \param y
+   *        inches, in the odom_pose_get() frame
+   * \param speed
+   *        0 to 127, max speed during motion
+   * \param slew_on
+   *        ramp up from slew_min to speed over slew_distance.  only use when you're going over about 14"
+   */
+  void pid_drive_to_point(double x, double y, int speed, bool slew_on = false);
+
+  /**
+   * Drives to a pose on the field, arriving at its heading.  The robot steers at a carrot point
+   * behind the target (boomerang), which pulls in towards the target as the robot gets closer.
+   *
+   * \param target
+   *        inches and degrees, in the odom_pose_get() frame
+   * \param speed
+   *        0 to 127, max speed during motion
+   * \param lead
+   *        how far behind the target the carrot starts, as a fraction of the distance.  0 drives
+   *        straight to the point, higher swings wider
+   * \param slew_on
+   *        ramp up from slew_min to speed over slew_distance.  only use when you're going over about 14"
+   */
+  void pid_drive_to_pose(pose target, int speed, double lead = 0.5, bool slew_on = false);
+
+  /**
+   * Follows a motion profile generated at build time (see include/path_specs.hpp).  The robot
+   * steers at a point a little further along the path and is capped to the path's velocity, and
+   * the drive target is what's left of the path, so pid_wait() and the drive exit conditions
+   * work the same.  Odometry must be enabled and start where the path does.  A path with no
+   * points does nothing.
+   *
+   * \param path
+   *        a path_<name> from paths.hpp, or one path_file_load() read
+   * \param speed
+   *        0 to 127, max speed during motion, where the path is fastest
+   * \param slew_on
+   *        ramp up from slew_min to speed over slew_distance.  only use when you're going over about 14"
+   */
+  void pid_path_set(const PathProfile& path, int speed, bool slew_on = false);
+
+  /**
+   * Updates a running pid_drive_to_point / pid_drive_to_pose / pid_path_set from the latest pose.  This never
+   * blocks, drive_task_step() calls it every 10ms just before the PIDs compute.
+   */
+  void pid_pose_step();
+
   /**
    * Lock the code in a while loop until this position has passed for turning or swinging with okapi units.
    *
@@ -938,6 +1274,37 @@ class Drive {
    */
   PID::Constants pid_swing_constants_get();
 
+  /**
+   * @brief Set a gain schedule for turns, see PID::gains_schedule_set().  Big and small turns
+   * each get their own gains instead of sharing pid_turn_constants_set()'s
+   *
+   * @param key         PID::SCHEDULE_ERROR (degrees left to turn) or PID::SCHEDULE_SPEED
+   * @param points      {at, kP, kI, kD} rows, an empty list goes back to the fixed constants
+   */
+  void pid_turn_gains_schedule_set(PID::ScheduleKey key, std::initializer_list<PID::GainPoint> points);
+
+  /**
+   * @brief Set a gain schedule for swings, see PID::gains_schedule_set()
+   *
+   * @param key         PID::SCHEDULE_ERROR (degrees left to swing) or PID::SCHEDULE_SPEED
+   * @param points      {at, kP, kI, kD} rows, an empty list goes back to the fixed constants
+   */
+  void pid_swing_gains_schedule_set(PID::ScheduleKey key, std::initializer_list<PID::GainPoint> points);
+
+  /**
+   * @brief Set a gain schedule for drives, forward and backward, see PID::gains_schedule_set()
+   *
+   * @param key         PID::SCHEDULE_ERROR (inches left to drive) or PID::SCHEDULE_SPEED
+   * @param points      {at, kP, kI, kD} rows, an empty list goes back to the fixed constants
+   */
+  void pid_drive_gains_schedule_set(PID::ScheduleKey key, std::initializer_list<PID::GainPoint> points);
+
+  /**
+   * Sets the running motion's gains from its schedule.  This never blocks, the drive task calls
+   * it every 10ms before the PIDs compute, so a tick never mixes old and new gains.
+   */
+  void pid_gains_schedule_step();
+
   /**
    * @brief Set the forward swing pid constants object
    *
@@ -1058,6 +1425,44 @@ class Drive {
    */
   PID::Constants pid_drive_constants_backward_get();
 
+  /**
+   * @brief Set the forward and backward drive feedforward constants.  Profiled drives
+   * (pid_drive_profiled_set) add these to the drive PIDs, units are out of 127
+   *
+   * @param kS          output that overcomes static friction
+   * @param kV          output per in/s of profile velocity
+   * @param kA          output per in/s^2 of profile acceleration
+   */
+  void pid_drive_feedforward_set(double kS, double kV = 0.0, double kA = 0.0);
+
+  /**
+   * @brief Set the forward drive feedforward constants
+   *
+   * @param kS          output that overcomes static friction
+   * @param kV          output per in/s of profile velocity
+   * @param kA          output per in/s^2 of profile acceleration
+   */
+  void pid_drive_feedforward_forward_set(double kS, double kV = 0.0, double kA = 0.0);
+
+  /**
+   * @brief returns forward drive feedforward constants with PID::Feedforward.
+   */
+  PID::Feedforward pid_drive_feedforward_forward_get();
+
+  /**
+   * @brief Set the backward drive feedforward constants
+   *
+   * @param kS          output that overcomes static friction
+   * @param kV          output per in/s of profile velocity
+   * @param kA          output per in/s^2 of profile acceleration
+   */
+  void pid_drive_feedforward_backward_set(double kS, double kV = 0.0, double kA = 0.0);
+
+  /**
+   * @brief returns backward drive feedforward constants with PID::Feedforward.
+   */
+  PID::Feedforward pid_drive_feedforward_backward_get();
+
   /**
    * Sets minimum power for swings when kI and startI are enabled.
    *
@@ -1293,6 +1698,36 @@ class Drive {
    */
   double pid_tuner_increment_start_i_get();
 
+  /**
+   * Tunes turn constants without a driver.  The robot turns target and back on the current
+   * constants, bangs its output between +relay and -relay around where it's pointing until it
+   * oscillates steadily, works kP and kD out of that oscillation, then turns target and back
+   * again on them.  The new constants are kept if they settle sooner without overshooting more.
+   * Blocks for 10 to 15 seconds, so give it room to spin in place.  A turn gain schedule is
+   * toggled off for the second run and stays off if the new constants are kept.
+   *
+   * \param target
+   *        degrees to turn for the before and after runs
+   * \param speed
+   *        0 to 127, max speed for the before and after runs
+   * \param relay
+   *        output the relay switches between, 0 to 127
+   */
+  autotune_result pid_turn_autotune(double target = 90, int speed = 90, int relay = 60);
+
+  /**
+   * Tunes drive constants without a driver, like pid_turn_autotune().  Forward and backward both
+   * get the new constants if they're kept.  Needs target inches of room in front of the robot.
+   *
+   * \param target
+   *        inches to drive for the before and after runs
+   * \param speed
+   *        0 to 127, max speed for the before and after runs
+   * \param relay
+   *        output the relay switches between, 0 to 127
+   */
+  autotune_result pid_drive_autotune(double target = 24, int speed = 110, int relay = 50);
+
  private:  // !Auton
   bool drive_toggle = true;
   bool print_toggle = true;
@@ -1387,6 +1822,12 @@ class Drive {
   double l_start = 0;
   double r_start = 0;
 
+  /**
+   * Attaches an action to the running motion, see pid_action_distance_add().  trigger is the
+   * action_trigger in motion_actions.cpp.
+   */
+  void pid_action_add(int trigger, double threshold, std::function<void()> action);
+
   /**
    * Enable/disable modifying controller curve with controller.
    */
@@ -71,6 +71,16 @@ enum e_mode { DISABLE = 0,
               TURN = 2,
               DRIVE = 3 };
 
+/**
+ * Position on the field.  x is to the right and y is forward of where odometry was zeroed, in
+ * inches.  theta is in degrees, clockwise positive, the same as the IMU and pid_turn_set().
+ */
+struct pose {
+  double x;
+  double y;
+  double theta;
+};
+
 /**
  * Outputs string for exit_condition enum.
  */
@@ -1,3 +1,7 @@
+extern pros::Motor Intake1;
+extern pros::Motor Intake2;
+
+void subsystemsInitialize();
 void intakeControl();
 void wingTeleControl();
 void scooperTeleControl();
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * Counts every call to operator new.  Only active when built with -DDEBUG_ALLOC_COUNT
+ * (add it to EXTRA_CXXFLAGS in the Makefile), otherwise this always returns 0.
+ */
+std::uint32_t alloc_count_get();
@@ -8,8 +8,13 @@ void drive_example();
 void turn_example();
 void drive_and_turn();
 void wait_until_change_speed();
+void actions_example();
 void swing_example();
 void combining_movements();
+void odom_example();
+void path_example();
+void profiled_drive_example();
+void autotune_example();
 void interfered_example();
 
 void skills();
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+
+#include "EZ-Template/PID.hpp"
+
+/**
+ * Heading hold for climbing.  Squares the robot to 0 or 180 degrees while the driver
+ * keeps control of the drive with tank.
+ */
+class ClimbHold {
+ public:
+  /**
+   * Heading PID, this uses the same constants as turnPID.
+   */
+  ez::PID pid;
+
+  /**
+   * Copies turnPID constants into the heading PID.  Call after default_constants().
+   */
+  void initialize();
+
+  /**
+   * Runs one tick.  Computes the heading hold and sets the drive to tank plus the hold output.
+   * This never blocks, call it once per control tick after sensors.update() and
+   * inputs.update().
+   */
+  void step();
+
+  /**
+   * Enables / disables the heading hold.
+   *
+   * \param input
+   *        true holds the heading, false gives the driver plain tank
+   */
+  void lock_set(bool input);
+
+  /**
+   * Returns true if the heading hold is enabled.
+   */
+  bool lock_get();
+
+  /**
+   * One button toggle for the heading hold.
+   *
+   * \param toggle
+   *        An input button.
+   */
+  void button_toggle(int toggle);
+
+  /**
+   * Returns the last output added to the drive.
+   */
+  double output_get();
+
+  /**
+   * Returns how long the last step() took, in microseconds.
+   */
+  std::uint32_t exec_get();
+
+  /**
+   * Returns the longest step() since initialize(), in microseconds.
+   */
+  std::uint32_t exec_max_get();
+
+ private:
+  bool lock = false;
+  double output = 0.0;
+  std::uint32_t exec = 0;
+  std::uint32_t exec_max = 0;
+};
+
+extern ClimbHold climbHold;
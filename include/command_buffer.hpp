@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstdint>
+
+#include "api.h"
+
+/**
+ * Every actuator output for one control tick, the write side of SensorFrame.  Control code sets
+ * outputs here instead of on the devices, then flush() writes the ones that changed since the
+ * last flush in one pass.  Devices are added the first time they're set.  Any task can use it,
+ * ie. opcontrol's scheduler, autonomous and EZ Action callbacks all set and flush the same one.
+ */
+class CommandBuffer {
+ public:
+  static constexpr int MAX_MOTORS = 12;
+  static constexpr int MAX_DIGITALS = 8;
+
+  /**
+   * Sets a motor's voltage for the next flush().
+   *
+   * \param motor
+   *        a motor that outlives the buffer, ie. a global
+   * \param voltage
+   *        -12000 to 12000 mV
+   */
+  void motor_set(const pros::Motor& motor, int voltage);
+
+  /**
+   * Sets a pneumatic's state for the next flush().
+   *
+   * \param output
+   *        an output that outlives the buffer, ie. a global
+   * \param value
+   *        true is extended
+   */
+  void digital_set(const pros::ADIDigitalOut& output, bool value);
+
+  /**
+   * Sets the drive for the next flush(), like chassis.drive_set().  Motors in the PTO list are
+   * left alone.  This stops a running PID motion right away so the drive task doesn't write
+   * over it.
+   *
+   * \param left
+   *        -127 to 127
+   * \param right
+   *        -127 to 127
+   */
+  void drive_set(int left, int right);
+
+  /**
+   * Writes every output that changed since the last flush.  Call it once per control tick,
+   * after everything that sets outputs.
+   */
+  void flush();
+
+  /**
+   * Drops every output set so far and forgets what was written.  Outputs set after this are
+   * written on the next flush() whether they changed or not, the rest are left alone.  Call
+   * this when a competition mode starts or after writing devices directly.
+   */
+  void invalidate();
+
+  /**
+   * Returns how many writes flush() has made.
+   */
+  std::uint32_t writes_get();
+
+  /**
+   * Returns how many writes flush() has skipped because the output didn't change.
+   */
+  std::uint32_t skipped_get();
+
+  /**
+   * Resets writes_get() and skipped_get().
+   */
+  void stats_reset();
+
+ private:
+  struct MotorSlot {
+    const pros::Motor* motor;
+    int voltage;
+    int written;
+  };
+  struct DigitalSlot {
+    const pros::ADIDigitalOut* output;
+    bool value;
+    bool written;
+  };
+  MotorSlot* motor_slot(const pros::Motor& motor);
+  void voltage_set(const pros::Motor& motor, int voltage);
+
+  // Held by every method that touches the slots, flush() holds it while it writes
+  pros::Mutex mutex;
+
+  MotorSlot motors[MAX_MOTORS];
+  DigitalSlot digitals[MAX_DIGITALS];
+  int motor_count = 0;
+  int digital_count = 0;
+
+  // Outputs to write no matter what, set by adding a device or invalidate()
+  std::uint32_t motors_stale = 0;
+  std::uint32_t digitals_stale = 0;
+
+  // Outputs invalidate() dropped that nothing has set since, flush() skips them
+  std::uint32_t motors_dropped = 0;
+  std::uint32_t digitals_dropped = 0;
+
+  std::uint32_t writes = 0;
+  std::uint32_t skipped = 0;
+};
+
+extern CommandBuffer commands;
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "api.h"
+
+/**
+ * The master controller for one control tick.  Buttons are bitmasks with bit(button) for each
+ * button, and edges come from comparing with the last frame, so any number of subsystems can
+ * ask about the same press.
+ */
+struct ControllerFrame {
+  static constexpr int ANALOG_COUNT = 4;
+
+  /**
+   * Returns the mask bit of a button.
+   */
+  static constexpr std::uint16_t bit(pros::controller_digital_e_t button) { return 1u << (button - pros::E_CONTROLLER_DIGITAL_L1); }
+
+  /**
+   * Increments every update.
+   */
+  std::uint32_t seq = 0;
+
+  /**
+   * pros::millis() when the frame was captured.
+   */
+  std::uint32_t time = 0;
+
+  /**
+   * Buttons held this frame, pressed since the last one, and released since the last one.
+   */
+  std::uint16_t pressed = 0;
+  std::uint16_t rising = 0;
+  std::uint16_t falling = 0;
+
+  /**
+   * Sticks, -127 to 127, in pros::controller_analog_e_t order.
+   */
+  std::int8_t analog[ANALOG_COUNT] = {};
+
+  /**
+   * Returns true if a button is held / was just pressed / was just released.
+   */
+  bool held(pros::controller_digital_e_t button) const { return pressed & bit(button); }
+  bool new_press(pros::controller_digital_e_t button) const { return rising & bit(button); }
+  bool new_release(pros::controller_digital_e_t button) const { return falling & bit(button); }
+
+  /**
+   * Returns a stick, like get_analog().
+   */
+  int analog_get(pros::controller_analog_e_t channel) const { return analog[channel]; }
+};
+
+/**
+ * Reads the master controller once per tick and publishes it as an immutable snapshot, the
+ * controller's SensorFrameService.  Call update() or replay() from one task, any task can call
+ * get().
+ */
+class ControllerFrameService {
+ public:
+  /**
+   * Reads the controller into the back buffer and publishes it.
+   */
+  void update();
+
+  /**
+   * Publishes a recorded frame instead of reading the controller, ie. the INPUTS telemetry
+   * records of an earlier run.  Edges are worked out the same way update() does, so replaying
+   * a log gets the same presses.
+   *
+   * \param pressed
+   *        buttons held
+   * \param analog
+   *        sticks, in pros::controller_analog_e_t order
+   */
+  void replay(std::uint16_t pressed, const std::int8_t (&analog)[ControllerFrame::ANALOG_COUNT]);
+
+  /**
+   * Plays a recording back instead of reading the controller.  update() asks source for the
+   * next frame every tick and replay()s it, then goes back to the controller once source
+   * returns false.  Set it before driver control starts, ie. sim --replay.
+   *
+   * \param source
+   *        fills in the next frame and returns true, or returns false when there are none left
+   */
+  void replay_set(bool (*source)(std::uint16_t& pressed, std::int8_t (&analog)[ControllerFrame::ANALOG_COUNT]));
+
+  /**
+   * Sets which buttons update() reads, buttons nothing uses don't need a device call every
+   * tick.  Defaults to all of them.
+   *
+   * \param mask
+   *        ControllerFrame::bit() of every button to read
+   */
+  void buttons_set(std::uint16_t mask);
+
+  /**
+   * Returns a copy of the latest frame.
+   */
+  ControllerFrame get();
+
+  /**
+   * Returns the latest frame without copying.  Only safe from the task that calls update().
+   */
+  const ControllerFrame& latest();
+
+ private:
+  void publish(std::uint16_t pressed, const std::int8_t (&analog)[ControllerFrame::ANALOG_COUNT]);
+
+  ControllerFrame frames[2];
+  std::atomic<std::uint32_t> published{0};
+  std::uint16_t buttons = 0x0fff;
+  std::uint32_t seq = 0;
+  bool (*replay_source)(std::uint16_t& pressed, std::int8_t (&analog)[ControllerFrame::ANALOG_COUNT]) = nullptr;
+};
+
+extern ControllerFrameService inputs;
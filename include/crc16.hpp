@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * CRC-16/CCITT (poly 0x1021, init 0xffff), for telemetry frames and path files.  Pass the last
+ * result as crc to continue it over more data.  This file has no PROS dependencies, the host
+ * tools build it too.
+ */
+std::uint16_t crc16(const std::uint8_t* data, std::size_t size, std::uint16_t crc = 0xffff);
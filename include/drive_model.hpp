@@ -0,0 +1,136 @@
+#pragma once
+
+/**
+ * Dynamic model of the drivetrain.  Everything is SI (meters, kilograms, seconds,
+ * radians, volts, amps) unless the name says otherwise.  This is plain math with no
+ * device calls, so it runs in the simulation plant, in feedforward and in offline sweeps.
+ */
+class DriveModel {
+ public:
+  /**
+   * Physical constants.  The defaults are this robot: 3 motors a side on 600 rpm
+   * cartridges, 1.333 external ratio and 2.75" wheels, same as the ez::Drive constructor.
+   * Call reset() after changing them.
+   */
+  struct Params {
+    // V5 motor at the cartridge output.  Stall torque is 2.1 Nm at 100 rpm and scales with the cartridge
+    double free_rpm = 600;
+    double stall_torque = 0.35;
+    double stall_current = 2.5;
+    double current_limit = 2.5;
+    double max_volts = 12.0;
+    int motors_per_side = 3;
+
+    // Drivetrain
+    double ratio = 1.333333;  // motor revolutions per wheel revolution
+    double wheel_diameter = 2.75 * 0.0254;
+    double track_width = 11.5 * 0.0254;
+    double wheel_base = 11.0 * 0.0254;
+    double efficiency = 0.85;
+
+    // Chassis
+    double mass = 6.8;
+    double inertia = 0.12;        // yaw moment of inertia, kg m^2
+    double rolling_force = 4.0;   // N, resists driving straight
+    double scrub_torque = 1.6;    // Nm, wheels sliding sideways when the robot turns
+    double viscous = 0.8;         // N per m/s and Nm per rad/s
+
+    // Battery
+    double battery_volts = 12.8;
+    double battery_resistance = 0.08;
+  };
+
+  /**
+   * Everything that changes.  Heading is counter clockwise positive, like squiggles::Pose.
+   */
+  struct State {
+    double x = 0;
+    double y = 0;
+    double theta = 0;
+    double velocity = 0;          // forward, m/s
+    double angular_velocity = 0;  // rad/s
+    double left_position = 0;     // wheel angle, rad
+    double right_position = 0;
+    double left_current = 0;      // per motor, amps
+    double right_current = 0;
+    double battery_volts = 12.8;
+  };
+
+  DriveModel();
+  DriveModel(Params params);
+
+  /**
+   * Advances the model.
+   *
+   * \param left_volts
+   *        voltage commanded to each left motor, positive drives forward
+   * \param right_volts
+   *        voltage commanded to each right motor, positive drives forward
+   * \param dt
+   *        time step in seconds, 1 ms matches the simulation tick
+   * \param left_coast
+   *        true if the left motors are in coast and commanded 0, so they freewheel instead of braking
+   * \param right_coast
+   *        true if the right motors are in coast and commanded 0
+   */
+  void step(double left_volts, double right_volts, double dt, bool left_coast = false, bool right_coast = false);
+
+  /**
+   * Wheel surface speeds for a forward velocity and curvature (1 / turn radius).  This is
+   * squiggles::TankModel::linear_to_wheel_vels with this model's track width.
+   */
+  void linear_to_wheel_vels(double velocity, double curvature, double& left, double& right) const;
+
+  /**
+   * Steady state voltage that holds a wheel surface speed, ignoring friction.  For feedforward.
+   */
+  double volts_for_speed(double wheel_speed) const;
+
+  /**
+   * Top speed of the robot driving straight, in m/s.
+   */
+  double free_speed() const;
+
+  /**
+   * Motor shaft speed in rpm for a wheel angular velocity.
+   */
+  double motor_rpm(double wheel_angular_velocity) const;
+
+  /**
+   * Wheel angular velocity of each side, rad/s.
+   */
+  double left_wheel_velocity() const;
+  double right_wheel_velocity() const;
+
+  /**
+   * Puts the robot back at the origin, stopped.
+   */
+  void reset();
+
+  /**
+   * Sets the heading, in radians counter clockwise.  Use this instead of writing state.theta.
+   */
+  void heading_set(double theta);
+
+  Params params;
+  State state;
+
+ private:
+  double motor_current(double volts, double wheel_angular_velocity, bool coast) const;
+  void precompute();
+
+  // Derived from params in precompute(), step() only multiplies
+  double wheel_radius = 0;
+  double back_emf = 0;       // volts per wheel rad/s
+  double resistance = 0;     // ohms per motor
+  double force_per_amp = 0;  // N at the wheel surface, per motor amp
+  double inverse_radius = 0;
+  double inverse_resistance = 0;
+  double inverse_mass = 0;
+  double inverse_inertia = 0;
+
+  // state.theta as a unit vector, renormalized from theta every 1000 steps
+  double heading_cos = 1;
+  double heading_sin = 0;
+  int steps_since_normalize = 0;
+};
@@ -46,6 +46,17 @@
 // More includes here...
 #include "autons.hpp"
 #include "Subsystems.hpp"
+#include "scheduler.hpp"
+#include "sensor_frame.hpp"
+#include "controller_frame.hpp"
+#include "command_buffer.hpp"
+#include "thermal_monitor.hpp"
+#include "startup.hpp"
+#include "timeline.hpp"
+#include "task_profiler.hpp"
+#include "climb.hpp"
+#include "telemetry.hpp"
+#include "paths.hpp"
 /**
  * If you find doing pros::Motor() to be tedious and you'd prefer just to do
  * Motor, you can use the namespace with the following commented out line.
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "EZ-Template/util.hpp"
+
+/**
+ * Optional callbacks around chassis motions, for profiling off the robot (ie. the
+ * simulation benchmark).  Every callback is null by default, so on the robot this costs
+ * one pointer check per motion.
+ */
+struct MotionTrace {
+  /**
+   * A pid_drive_set / pid_turn_set / pid_swing_set started.  Only the host build of
+   * EZ-Template calls this, the one in firmware/EZ-Template.a can't.
+   */
+  void (*motion_start)(ez::e_mode mode, double target) = nullptr;
+
+  /**
+   * pid_wait() started waiting.
+   */
+  void (*wait_begin)() = nullptr;
+
+  /**
+   * pid_wait() is returning.  Drives pass the left and right exits, turns and swings
+   * pass their exit twice.  This isn't called if no motion was running.
+   */
+  void (*wait_end)(ez::exit_output first, ez::exit_output second) = nullptr;
+};
+
+extern MotionTrace motion_trace;
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "path_profile.hpp"
+
+/**
+ * Binary path files, for profiles kept on the SD card instead of in paths.hpp.  A file is
+ *
+ *   [PathFileHeader, 44 bytes] [x] [y] [theta] [velocity] [curvature] [distance]
+ *
+ * where every column is count little endian floats.  The columns are used in place, so loading
+ * a path is one fread into a buffer and checking the header and CRC, nothing is parsed.
+ * sim/bin/pathconv writes these from paths.hpp or CSV.  This file has no PROS dependencies, the
+ * host tools build it too.
+ *
+ *   alignas(4) static std::uint8_t skills_buffer[16 * 1024];
+ *   PathProfile skills;
+ *   if (path_file_load("/usd/skills.ezp", skills_buffer, sizeof(skills_buffer), skills))
+ *     chassis.pid_path_set(skills, DRIVE_SPEED);
+ */
+constexpr std::uint16_t PATH_FILE_VERSION = 1;
+constexpr std::uint16_t PATH_FILE_REVERSED = 1 << 0;
+constexpr int PATH_FILE_COLUMNS = 6;
+constexpr std::size_t PATH_FILE_NAME_SIZE = 24;
+
+struct PathFileHeader {
+  char magic[4];  // "EZPF"
+  std::uint16_t version;
+  std::uint16_t flags;
+  std::uint32_t count;
+  float dt;
+  char name[PATH_FILE_NAME_SIZE];  // 0 terminated
+  std::uint16_t crc;               // crc16() of the header up to here, then the columns
+  std::uint16_t reserved;
+};
+static_assert(sizeof(PathFileHeader) == 44, "path files need the header packed, and the columns 4 byte aligned");
+
+/**
+ * Size of a path file with count points.
+ */
+constexpr std::size_t path_file_size(std::uint32_t count) { return sizeof(PathFileHeader) + (std::size_t)count * PATH_FILE_COLUMNS * sizeof(float); }
+
+/**
+ * Writes path as a file image.  output needs path_file_size(path.count) bytes.  Returns the
+ * number of bytes written, or 0 if the path's name doesn't fit.
+ */
+std::size_t path_file_write(const PathProfile& path, std::uint8_t* output);
+
+/**
+ * Checks a file image and points path into it, so data has to outlive path and be 4 byte
+ * aligned.  Returns false if it's the wrong size, a different version or fails the CRC.
+ */
+bool path_file_parse(const std::uint8_t* data, std::size_t size, PathProfile& path);
+
+/**
+ * Reads a path file into buffer with a single fread, then path_file_parse()s it.  Returns false
+ * if the file can't be opened, is bigger than capacity or doesn't parse.
+ */
+bool path_file_load(const char* filename, std::uint8_t* buffer, std::size_t capacity, PathProfile& path);
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * One sample of a motion profile, in the odometry frame (see ez::pose): inches, degrees clockwise,
+ * inches per second.  This holds what squiggles::ProfilePoint does, as floats so a table of them
+ * is small enough to live in flash.
+ */
+struct PathPoint {
+  float x;
+  float y;
+  float theta;      // direction the robot faces, so reversed paths face away from travel
+  float velocity;   // center of the robot, negative when reversed
+  float curvature;  // 1 / turn radius, positive curving clockwise
+  float distance;   // path length up to this point
+};
+
+/**
+ * A generated motion profile, stored as one array per field so the same struct can point at
+ * const tables in flash (paths.hpp) or straight into a path file loaded off the SD card
+ * (path_file.hpp).  Points are every dt seconds along the path, so point i is where the robot
+ * should be i * dt seconds in.
+ */
+struct PathProfile {
+  const char* name;
+  std::uint32_t count;
+  float dt;
+  bool reversed;
+  const float* x;
+  const float* y;
+  const float* theta;
+  const float* velocity;
+  const float* curvature;
+  const float* distance;
+
+  PathPoint point(std::uint32_t i) const { return {x[i], y[i], theta[i], velocity[i], curvature[i], distance[i]}; }
+};
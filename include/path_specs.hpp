@@ -0,0 +1,41 @@
+#pragma once
+
+/**
+ * Paths for sim/bin/pathgen.  After editing this, run `make paths` and commit the src/paths.cpp
+ * and include/paths.hpp it writes, so the robot only ever sees finished PathProfile tables in
+ * flash and nothing is generated at runtime.
+ *
+ * Waypoints are poses in the odometry frame (inches, degrees clockwise, see ez::pose).  Add a
+ * path by adding a PathSpec to PATH_SPECS, it becomes `extern const PathProfile path_<name>`.
+ */
+
+struct PathWaypoint {
+  double x;
+  double y;
+  double theta;
+};
+
+struct PathConstraints {
+  double max_velocity = 55.0;       // in/s, the drive tops out around 64
+  double max_acceleration = 120.0;  // in/s^2
+  double track_width = 11.5;        // in, slows the center down so the outside wheels stay under max_velocity
+};
+
+struct PathSpec {
+  const char* name;
+  const PathWaypoint* waypoints;
+  int count;
+  bool reversed;
+  PathConstraints constraints;
+};
+
+// Curve out to the right and come back in facing forward
+static const PathWaypoint EXAMPLE_CURVE[] = {{0, 0, 0}, {24, 36, 45}, {24, 60, 0}};
+
+// Back up along a curve to where EXAMPLE_CURVE started
+static const PathWaypoint EXAMPLE_RETURN[] = {{24, 60, 0}, {0, 24, 0}, {0, 0, 0}};
+
+static const PathSpec PATH_SPECS[] = {
+    {"example_curve", EXAMPLE_CURVE, 3, false, {}},
+    {"example_return", EXAMPLE_RETURN, 3, true, {}},
+};
@@ -0,0 +1,11 @@
+#pragma once
+
+// Generated by sim/bin/pathgen from include/path_specs.hpp, edit that instead
+
+#include "path_profile.hpp"
+
+extern const PathProfile path_example_curve;
+extern const PathProfile path_example_return;
+
+constexpr int PATH_COUNT = 2;
+extern const PathProfile* const PATHS[PATH_COUNT];
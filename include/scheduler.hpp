@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "EZ-Template/util.hpp"
+
+/**
+ * Time source used by the scheduler.  Defaults to the PROS RTOS, but any set of
+ * functions with the same semantics can be swapped in (ie. a virtual clock on Linux).
+ */
+struct SchedulerClock {
+  std::uint32_t (*millis)();
+  std::uint64_t (*micros)();
+  void (*delay_until)(std::uint32_t* prev_time, std::uint32_t delta);
+};
+
+/**
+ * Returns a clock backed by pros::c::millis, pros::c::micros and pros::c::task_delay_until.
+ */
+SchedulerClock scheduler_pros_clock();
+
+/**
+ * Runs registered callbacks at a fixed rate with task_delay_until semantics, so the
+ * loop period doesn't grow with the time spent inside the callbacks.
+ */
+class ControlScheduler {
+ public:
+  /**
+   * Timing for one registered callback.  All times are in microseconds.
+   */
+  struct Stats {
+    std::uint32_t runs = 0;
+    std::uint32_t overruns = 0;
+    std::uint32_t period = 0;
+    std::uint32_t period_max = 0;
+    std::uint32_t exec = 0;
+    std::uint32_t exec_max = 0;
+  };
+
+  /**
+   * Creates a scheduler.
+   *
+   * \param tick_ms
+   *        base period of the scheduler, defaults to ez::util::DELAY_TIME
+   * \param clock
+   *        time source, defaults to the PROS RTOS
+   */
+  ControlScheduler(int tick_ms = ez::util::DELAY_TIME, SchedulerClock clock = scheduler_pros_clock());
+
+  /**
+   * Registers a callback and returns its id.  Callbacks run in the order they were added.
+   *
+   * \param name
+   *        name that prints with the stats
+   * \param callback
+   *        function to run
+   * \param period_ms
+   *        how often to run the callback, rounded to a multiple of the tick.  0 runs every tick
+   */
+  int add(std::string name, std::function<void()> callback, int period_ms = 0);
+
+  /**
+   * Removes every callback.
+   */
+  void clear();
+
+  /**
+   * Runs every callback that is due this tick.
+   */
+  void tick();
+
+  /**
+   * Blocks until the next tick is due.  If the last tick ran past the following
+   * deadline the schedule is resynced instead of bursting to catch up.
+   */
+  void wait();
+
+  /**
+   * Runs tick() and wait() forever.  Call this from the task that owns the scheduler.
+   */
+  void run();
+
+  /**
+   * Returns the number of registered callbacks.
+   */
+  int size();
+
+  /**
+   * Returns the stats for a callback.
+   *
+   * \param id
+   *        id returned by add()
+   */
+  Stats stats_get(int id);
+
+  /**
+   * Returns the name of a callback.
+   *
+   * \param id
+   *        id returned by add()
+   */
+  std::string name_get(int id);
+
+  /**
+   * Returns the number of ticks that missed their deadline.
+   */
+  std::uint32_t late_ticks_get();
+
+  /**
+   * Resets all stats.
+   */
+  void stats_reset();
+
+  /**
+   * Prints the stats of every callback to the terminal.
+   */
+  void stats_print();
+
+  /**
+   * Returns the base period in ms.
+   */
+  int tick_ms_get();
+
+ private:
+  struct Entry {
+    std::string name;
+    std::function<void()> callback;
+    int divider = 1;
+    std::uint64_t last_start = 0;
+    Stats stats;
+  };
+  std::vector<Entry> entries;
+  SchedulerClock clock;
+  int tick_ms;
+  std::uint32_t tick_count = 0;
+  std::uint32_t late_ticks = 0;
+  std::uint32_t wake_time = 0;
+  bool started = false;
+};
+
+/**
+ * Scheduler that runs the teleop control loop.
+ */
+extern ControlScheduler scheduler;
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "api.h"
+
+/**
+ * The smart device readings the control tick uses, read once per tick.  Only what something
+ * reads is in here, the library's tasks still read the devices themselves, so every field is
+ * a device call that has to earn its place.
+ */
+struct SensorFrame {
+  /**
+   * Increments every update.
+   */
+  std::uint32_t seq = 0;
+
+  /**
+   * When the sensored left drive motor sampled the readings, its get_raw_position() timestamp
+   * in ms.  pros::millis() when the frame was captured if the motor didn't answer.
+   */
+  std::uint32_t time = 0;
+
+  /**
+   * Fused heading, this is the same as chassis.drive_heading_get().
+   */
+  double heading = 0;
+
+  /**
+   * IMU yaw rate in degrees per second.
+   */
+  double gyro_z = 0;
+
+  /**
+   * Velocity of the sensored left / right drive motor in rpm.
+   */
+  float left_velocity = 0;
+  float right_velocity = 0;
+
+  /**
+   * Current draw of the sensored left / right drive motor in mA.
+   */
+  std::int32_t left_current = 0;
+  std::int32_t right_current = 0;
+};
+
+/**
+ * Reads the devices once per tick and publishes the result as an immutable snapshot.
+ * Call update() from one task, any task can call get().
+ */
+class SensorFrameService {
+ public:
+  /**
+   * Reads the devices into the back buffer and publishes it.
+   */
+  void update();
+
+  /**
+   * Returns a copy of the latest frame.
+   */
+  SensorFrame get();
+
+  /**
+   * Returns the latest frame without copying.  Only safe from the task that calls update().
+   */
+  const SensorFrame& latest();
+
+  /**
+   * Returns how long the last update() took, in microseconds.
+   */
+  std::uint32_t exec_get();
+
+ private:
+  SensorFrame frames[2];
+  std::atomic<std::uint32_t> published{0};
+  std::uint32_t exec = 0;
+  std::uint32_t seq = 0;
+};
+
+extern SensorFrameService sensors;
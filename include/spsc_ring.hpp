@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Fixed size ring buffer for one producer task and one consumer task.  Neither side ever
+ * blocks or allocates: push() drops the item and counts it if the ring is full.
+ *
+ * \tparam T
+ *         item type, copied in and out
+ * \tparam N
+ *         capacity, must be a power of two
+ */
+template <typename T, std::size_t N>
+class SpscRing {
+  static_assert(N > 0 && (N & (N - 1)) == 0, "SpscRing capacity must be a power of two");
+
+ public:
+  /**
+   * Adds an item.  Only call this from the producer task.  Returns false if the ring was full.
+   */
+  bool push(const T& item) {
+    std::uint32_t h = head.load(std::memory_order_relaxed);
+    if (h - tail.load(std::memory_order_acquire) == N) {
+      dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    items[h & (N - 1)] = item;
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * Removes up to max items into output, oldest first, and returns how many.  Only call this
+   * from the consumer task.
+   */
+  std::size_t pop(T* output, std::size_t max) {
+    std::uint32_t t = tail.load(std::memory_order_relaxed);
+    std::uint32_t available = head.load(std::memory_order_acquire) - t;
+    std::size_t count = available < max ? available : max;
+    for (std::size_t i = 0; i < count; i++) output[i] = items[(t + i) & (N - 1)];
+    tail.store(t + count, std::memory_order_release);
+    return count;
+  }
+
+  /**
+   * Returns the number of items waiting.  Only a snapshot if the other side is running.
+   */
+  std::size_t size() const { return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire); }
+
+  /**
+   * Returns the number of items push() dropped because the ring was full.
+   */
+  std::uint32_t dropped_get() const { return dropped.load(std::memory_order_relaxed); }
+
+  static constexpr std::size_t capacity() { return N; }
+
+ private:
+  T items[N];
+  std::atomic<std::uint32_t> head{0};
+  std::atomic<std::uint32_t> tail{0};
+  std::atomic<std::uint32_t> dropped{0};
+};
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+/**
+ * Runs the slow parts of initialize() as concurrent stages instead of one after another, so
+ * boot to ready is the longest stage (IMU calibration) instead of the sum of all of them.  Each
+ * stage gets its own task.  initialize() returns as soon as they're started, and autonomous()
+ * and opcontrol() wait() on them before moving the robot.
+ */
+class Startup {
+ public:
+  static constexpr int MAX_STAGES = 8;
+
+  /**
+   * Adds a stage and returns its id.  Call this before start().
+   *
+   * \param name
+   *        name that prints with the timing
+   * \param callback
+   *        function to run, the stage is done when it returns
+   * \param after
+   *        id of a stage that has to finish before this one starts, ie. two stages that both
+   *        use the SD card.  -1 starts right away
+   */
+  int add(const char* name, std::function<void()> callback, int after = -1);
+
+  /**
+   * Starts every stage.
+   */
+  void start();
+
+  /**
+   * Returns true once every stage is done.
+   */
+  bool ready();
+
+  /**
+   * Blocks until every stage is done.  Returns false and prints the stages that aren't if it
+   * gives up first.
+   *
+   * \param timeout_ms
+   *        how long to wait
+   */
+  bool wait(int timeout_ms = 4000);
+
+  /**
+   * Returns the ms after boot the last stage finished, 0 while it hasn't.
+   */
+  std::uint32_t ready_time_get();
+
+  /**
+   * Prints when every stage started and how long it took to the terminal.
+   */
+  void print();
+
+ private:
+  struct Stage {
+    Startup* startup;
+    const char* name;
+    std::function<void()> callback;
+    int after;
+    std::uint32_t start;
+    std::uint32_t end;
+    std::atomic<bool> done;
+  };
+  static void task_function(void* parameter);
+
+  Stage stages[MAX_STAGES];
+  int stage_count = 0;
+  std::atomic<int> remaining{0};
+  std::atomic<std::uint32_t> ready_time{0};
+};
+
+extern Startup startup;
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * Loop timing for one task.  Every cycle's period (start to start) and execution time go into
+ * fixed bucket histograms, and a cycle that starts more than a millisecond late (one RTOS tick)
+ * or runs longer than its period counts as a deadline miss.  Only the task that owns a profile
+ * writes to it.
+ */
+class TaskProfile {
+ public:
+  static constexpr int BUCKETS = 16;
+
+  /**
+   * Upper edge of every bucket but the last in microseconds, the last one is everything over.
+   * Tight around the 5ms and 10ms loops.
+   */
+  static constexpr std::uint32_t BUCKET_EDGES[BUCKETS - 1] = {100, 250, 500, 1000, 2000, 4000, 5000, 6000, 8000, 10000, 11000, 12500, 15000, 20000, 25000};
+
+  /**
+   * Times one cycle, from where it's made to the end of the scope.  Does nothing while the
+   * profiler is off.
+   */
+  class Scope {
+   public:
+    Scope(TaskProfile* profile) : profile(active.load(std::memory_order_relaxed) ? profile : nullptr) {
+      if (this->profile) this->profile->begin();
+    }
+    ~Scope() {
+      if (profile) profile->end();
+    }
+
+   private:
+    TaskProfile* profile;
+  };
+
+  /**
+   * Starts / ends a cycle.  Prefer Scope.
+   */
+  void begin();
+  void end();
+
+  /**
+   * Starts the period over, for a loop that stops between runs on purpose so the gap isn't
+   * counted as a late cycle.
+   */
+  void restart();
+
+  /**
+   * Returns the task name.
+   */
+  const char* name_get();
+
+  /**
+   * Returns how many cycles were timed.
+   */
+  std::uint32_t cycles_get();
+
+  /**
+   * Returns how many cycles missed their deadline.
+   */
+  std::uint32_t misses_get();
+
+  /**
+   * Returns the period / execution time under which a fraction of cycles were, in
+   * microseconds.  This is the edge of the bucket it lands in, or the max for the last bucket.
+   *
+   * \param fraction
+   *        0 to 1, ie. 0.99
+   */
+  std::uint32_t period_percentile_get(double fraction);
+  std::uint32_t exec_percentile_get(double fraction);
+
+  /**
+   * Clears the histograms.
+   */
+  void reset();
+
+  /**
+   * Prints both histograms to the terminal.
+   */
+  void print();
+
+  /**
+   * Shows the percentiles and misses on the brain screen.
+   */
+  void screen_print();
+
+ private:
+  friend class Profiler;
+  static std::atomic<bool> active;
+
+  std::uint32_t percentile(const std::uint32_t (&counts)[BUCKETS], std::uint32_t max, double fraction);
+  static int bucket(std::uint32_t us);
+
+  const char* name = "";
+  std::uint32_t period_us = 0;
+  std::uint32_t start = 0;
+  std::uint32_t last_start = 0;
+  std::uint32_t cycles = 0;
+  std::uint32_t misses = 0;
+  std::uint32_t period_counts[BUCKETS] = {};
+  std::uint32_t exec_counts[BUCKETS] = {};
+  std::uint32_t period_max = 0;
+  std::uint32_t exec_max = 0;
+};
+
+/**
+ * Every task's TaskProfile.  Off by default, then a profiled loop costs one atomic load per
+ * cycle.  While it's on, the center LLEMU button pages through the tasks on the brain screen
+ * and prints the one it lands on to the terminal.
+ */
+class Profiler {
+ public:
+  static constexpr int MAX_TASKS = 8;
+
+  /**
+   * Returns the profile for a task, adding it the first time.  Call it once before the task's
+   * loop and time each cycle with TaskProfile::Scope.
+   *
+   * \param name
+   *        a string literal, the profile keeps the pointer
+   * \param period_ms
+   *        how often the loop is meant to run
+   */
+  TaskProfile* add(const char* name, int period_ms);
+
+  /**
+   * Turns timing on / off.
+   *
+   * \param input
+   *        true times every profiled loop, false leaves them alone
+   */
+  void toggle(bool input);
+
+  /**
+   * Sets what the center LLEMU button does while timing is off.  PROS can't say what's
+   * registered, so anything else that wants the button should register it here, and toggle()
+   * puts it back when timing turns off.
+   *
+   * \param callback
+   *        the button's callback, nullptr for none
+   */
+  void screen_button_set(void (*callback)());
+
+  /**
+   * Returns true if timing is on.
+   */
+  bool enabled();
+
+  /**
+   * Clears every task's histograms.
+   */
+  void reset();
+
+  /**
+   * Prints every task's histograms to the terminal.
+   */
+  void print();
+
+  /**
+   * Shows the next task on the brain screen and prints it to the terminal.
+   */
+  void screen_next();
+
+ private:
+  TaskProfile profiles[MAX_TASKS];
+  std::atomic<int> profile_count{0};
+  int screen_task = -1;
+  void (*screen_button)() = nullptr;
+};
+
+extern Profiler profiler;
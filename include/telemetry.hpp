@@ -0,0 +1,141 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "spsc_ring.hpp"
+
+/**
+ * Binary telemetry.  Control tasks push fixed size records into their own ring, which never
+ * blocks, and a low priority task drains the rings to the SD card in 4KB blocks and, once
+ * serial_enable() is called, to the "eztl" serial stream as frames (see telemetry_frame.hpp).
+ * Nothing is recorded without either.
+ *
+ * The file starts with an 8 byte header ("EZTL", then the version and record size as
+ * uint16), followed by records back to back, little endian.
+ */
+class Telemetry {
+ public:
+  enum Source : std::uint8_t {
+    /**
+     * Odometry task, every 10ms.  values: left error, right error, heading error, turn error,
+     * swing error, pose x, pose y, pose theta.  mode is the ez::e_mode
+     */
+    DRIVE = 1,
+
+    /**
+     * Opcontrol scheduler, every tick.  values: heading, gyro z, climb hold error, climb hold
+     * output, left velocity, right velocity, left current, right current.  mode is 1 when the
+     * climb hold is locked
+     */
+    CONTROL = 2,
+
+    /**
+     * pid_wait(), once per motion.  values: first exit, second exit, first error, second
+     * error, turns and swings repeat theirs.  mode is the ez::e_mode
+     */
+    EXIT = 3,
+
+    /**
+     * Opcontrol scheduler, every tick.  values: buttons held as a ControllerFrame mask, then the
+     * four sticks.  Feed these to inputs.replay() to drive the robot the same way again, sim
+     * --replay plays a whole file back
+     */
+    INPUTS = 4,
+  };
+
+  struct Record {
+    std::uint32_t time;  // pros::millis()
+    Source source;
+    std::uint8_t mode;
+    std::uint16_t seq;  // per source, a gap means records were dropped
+    float values[8];
+  };
+
+  static constexpr std::uint16_t VERSION = 1;
+  static constexpr int RING_SIZE = 256;
+  using Ring = SpscRing<Record, RING_SIZE>;
+
+  /**
+   * One ring per producer.  Only the odometry task pushes to drive_ring, only the opcontrol
+   * scheduler pushes to control_ring, and only the task running the auton pushes to event_ring.
+   */
+  Ring drive_ring;
+  Ring control_ring;
+  Ring event_ring;
+
+  /**
+   * Opens a new file on the SD card and starts the writer task.  Does nothing without an SD card.
+   */
+  void initialize();
+
+  /**
+   * Returns true if records are being written.
+   */
+  bool enabled();
+
+  /**
+   * Starts / stops streaming records over USB serial.  Writes never block, if the stream falls
+   * behind frames are dropped.  Decode them on the computer with sim/bin/tlm_decode.
+   *
+   * \param input
+   *        true streams, false stops
+   */
+  void serial_enable(bool input);
+
+  /**
+   * Returns true if records are being streamed over serial.
+   */
+  bool serial_enabled();
+
+  /**
+   * Pushes a record.  Never blocks, does nothing if telemetry isn't enabled.
+   *
+   * \param ring
+   *        the producing task's ring
+   */
+  void record(Ring& ring, Source source, std::uint8_t mode, const float (&values)[8]);
+
+  /**
+   * Records the drive state.  The odometry task calls this.
+   */
+  void drive_record();
+
+  /**
+   * Records the opcontrol state from the latest sensor frame.  Runs as a scheduler callback.
+   */
+  void control_record();
+
+  /**
+   * Records the latest controller frame.  Runs as a scheduler callback.
+   */
+  void input_record();
+
+  /**
+   * Records how a motion ended.  pid_wait() calls this.
+   */
+  void exit_record(std::uint8_t mode, int first_exit, int second_exit, double first_error, double second_error);
+
+  /**
+   * Returns the number of records taken from the rings to be written out.
+   */
+  std::uint32_t written_get();
+
+  /**
+   * Returns the number of records dropped because a ring was full.
+   */
+  std::uint32_t dropped_get();
+
+ private:
+  static void writer_task(void* parameter);
+  void writer_start();
+  void drain();
+
+  bool active = false;
+  bool serial = false;
+  // DRIVE and CONTROL/INPUTS records come from different tasks
+  std::atomic<std::uint16_t> seq[5] = {};
+  std::uint32_t written = 0;
+};
+
+extern Telemetry telemetry;
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "telemetry.hpp"
+
+/**
+ * Framing for telemetry sent over serial.  A frame is
+ *
+ *   [version u8] [Telemetry::Record, 40 bytes] [crc16() of the first 41 bytes, u16]
+ *
+ * COBS encoded and followed by a 0 byte, so a reader that starts mid stream resyncs on the
+ * next 0.  This file has no PROS dependencies, the host decoder builds it too.
+ */
+constexpr std::uint8_t TELEMETRY_FRAME_VERSION = 1;
+constexpr std::size_t TELEMETRY_FRAME_SIZE = 1 + sizeof(Telemetry::Record) + 2;
+
+/**
+ * Largest encoded frame, including the 0 delimiter.
+ */
+constexpr std::size_t TELEMETRY_FRAME_ENCODED_MAX = TELEMETRY_FRAME_SIZE + TELEMETRY_FRAME_SIZE / 254 + 2;
+
+/**
+ * COBS encodes size bytes of input into output, which needs size + size / 254 + 1 bytes.
+ * Returns the encoded size, without a delimiter.
+ */
+std::size_t cobs_encode(const std::uint8_t* input, std::size_t size, std::uint8_t* output);
+
+/**
+ * COBS decodes size bytes of input (without the delimiter) into output, which needs size
+ * bytes.  Returns the decoded size, or 0 if the input isn't valid COBS.
+ */
+std::size_t cobs_decode(const std::uint8_t* input, std::size_t size, std::uint8_t* output);
+
+/**
+ * Encodes a record as a frame, including the 0 delimiter.  output needs
+ * TELEMETRY_FRAME_ENCODED_MAX bytes.  Returns the number of bytes written.
+ */
+std::size_t telemetry_frame_encode(const Telemetry::Record& record, std::uint8_t* output);
+
+/**
+ * Decodes one frame (without the 0 delimiter).  Returns false if the frame is the wrong size,
+ * a different version or fails the CRC.
+ */
+bool telemetry_frame_decode(const std::uint8_t* frame, std::size_t size, Telemetry::Record& record);
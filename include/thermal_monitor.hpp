@@ -0,0 +1,151 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace pros {
+class Motor;
+}
+
+/**
+ * Predicts when the drive and intake motors will overheat.  V5 motors halve their current limit
+ * at 55C without saying so, which makes late skills motions slow and inconsistent.  A low
+ * priority task samples every motor's temperature and current draw every SAMPLE_MS and runs
+ * each through a first order thermal model:
+ *
+ *   dT/dt = heating * I^2 - (T - ambient) / time_constant
+ *
+ * The model fills in between the motors' 5C temperature steps and, held at the recent current
+ * draw, says how long until a motor reaches DERATE_TEMPERATURE.  Motors are the drive motors
+ * (left then right) followed by the intake motors.
+ */
+class ThermalMonitor {
+ public:
+  static constexpr int MAX_MOTORS = 12;
+  static constexpr int SAMPLE_MS = 200;
+  static constexpr double DERATE_TEMPERATURE = 55.0;
+
+  /**
+   * Starts the sampling task.  Call it after chassis.initialize().
+   */
+  void initialize();
+
+  /**
+   * Sets the thermal model.  The defaults are rough numbers for an 11W motor, fit them by
+   * logging temperature_get() against the motors' own readings over a skills run.
+   *
+   * \param heating
+   *        C per A^2 per second
+   * \param time_constant
+   *        seconds for the motor to cool 63% of the way back to ambient
+   */
+  void model_set(double heating, double time_constant);
+
+  /**
+   * Returns the model's temperature of a motor in C.
+   */
+  double temperature_get(int motor);
+
+  /**
+   * Returns the seconds until a motor derates if it keeps drawing what it has been, 0 if it
+   * already has and INFINITY if it never will.
+   */
+  double derate_time_get(int motor);
+
+  /**
+   * Returns the soonest derate_time_get() of the drive motors.
+   */
+  double drive_derate_time_get();
+
+  /**
+   * Returns the soonest derate_time_get() of the intake motors.
+   */
+  double intake_derate_time_get();
+
+  /**
+   * How far ahead the speed hooks look, and the least they'll scale speed to.  Defaults to 30s
+   * and 0.6.
+   *
+   * \param seconds
+   *        speed starts coming down when a derate is predicted sooner than this
+   * \param min_scale
+   *        0 to 1, speed never scales lower than this
+   */
+  void speed_horizon_set(double seconds, double min_scale);
+
+  /**
+   * Returns 1 while the drive isn't going to derate within the horizon, then down to min_scale
+   * as the drive's derate time goes to 0.  Running slower draws less current, so this pushes
+   * the derate out instead of hitting it mid-motion.
+   */
+  double drive_speed_scale_get();
+
+  /**
+   * Scales a speed by drive_speed_scale_get(), ie. chassis.pid_drive_set(24_in,
+   * thermal.drive_speed(DRIVE_SPEED)).
+   *
+   * \param speed
+   *        0 to 127
+   */
+  int drive_speed(int speed);
+
+  /**
+   * Lets the monitor scale down the running motion's max speed, so every motion gets
+   * drive_speed() without changing the autons.
+   *
+   * \param input
+   *        true scales chassis motions, false leaves them alone
+   */
+  void drive_limit_toggle(bool input);
+
+  /**
+   * Returns true if drive_limit_toggle() is on.
+   */
+  bool drive_limit_enabled();
+
+  /**
+   * Scales the running motion's max speed and slews for drive_limit_toggle().  The drive task
+   * calls this every 10ms just before the PIDs compute, so only that task changes them.
+   */
+  void drive_limit_step();
+
+  /**
+   * Prints every motor's model temperature and derate time to the terminal.
+   */
+  void print();
+
+  /**
+   * Runs one sample.  The task calls this every SAMPLE_MS.
+   */
+  void step();
+
+ private:
+  static void task_function(void* parameter);
+  double derate_time(int motor);
+
+  double heating = 0.08;
+  double time_constant = 240.0;
+  double horizon = 30.0;
+  double min_scale = 0.6;
+  std::atomic<bool> drive_limit{false};
+
+  // drive_speed_scale_get(), worked out every sample for the drive task to read
+  std::atomic<double> drive_scale{1.0};
+
+  // Speed of the running motion before drive_limit scaled it, and what it scaled it to.  Only
+  // the drive task touches these
+  int speed_unscaled = 0;
+  int speed_scaled = -1;
+
+  const pros::Motor* motors[MAX_MOTORS] = {};
+  int drive_count = 0;
+  int motor_count = 0;
+  double ambient[MAX_MOTORS] = {};
+  double temperature[MAX_MOTORS] = {};
+  double current_squared[MAX_MOTORS] = {};  // A^2, averaged over the last few seconds
+  double derate[MAX_MOTORS] = {};
+  std::uint32_t last_time = 0;
+  bool started = false;
+};
+
+extern ThermalMonitor thermal;
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+
+namespace ez {
+class Drive;
+}
+
+/**
+ * Timestamps the robot's lifecycle into a fixed buffer: every competition phase, the startup
+ * stages, and for each phase the first control tick and the first motor output that actually
+ * reached a motor.  Each phase starts the buffer over, so a robot left on between matches
+ * doesn't run out of room.  Nothing allocates and marking never blocks, so any task can mark.
+ * Dump it with print() or save() before the next phase starts.
+ */
+class Timeline {
+ public:
+  static constexpr int MAX_EVENTS = 96;
+
+  enum Kind : std::uint8_t {
+    PHASE,  // a competition phase started, initialize(), autonomous() etc.
+    BEGIN,  // a step started
+    END,    // a step finished
+    MARK,   // something happened
+  };
+
+  struct Event {
+    std::uint64_t time;  // pros::micros()
+    const char* name;
+    Kind kind;
+  };
+
+  /**
+   * Empties the buffer, marks the start of a competition phase, and watches for its first tick
+   * and first output.  A task still marking from the last phase can't land in this one.
+   *
+   * \param name
+   *        a string literal, the buffer keeps the pointer
+   */
+  void phase_begin(const char* name);
+
+  /**
+   * Marks the start or end of a step.
+   *
+   * \param name
+   *        a string literal, the buffer keeps the pointer
+   */
+  void begin(const char* name);
+  void end(const char* name);
+
+  /**
+   * Marks something that happened.
+   *
+   * \param name
+   *        a string literal, the buffer keeps the pointer
+   */
+  void mark(const char* name);
+
+  /**
+   * Marks "first tick" the first time it's called in a phase.  Call it every control tick.
+   */
+  void tick();
+
+  /**
+   * Marks "first output" once a drive motor reports a voltage for the first time in a phase.
+   * The odometry task calls this every step, it only reads the motors until it finds one.
+   *
+   * \param drive
+   *        the drive to watch
+   */
+  void output_check(ez::Drive& drive);
+
+  /**
+   * Returns how many events are in the buffer.
+   */
+  int size();
+
+  /**
+   * Returns an event, oldest first.
+   *
+   * \param index
+   *        0 to size() - 1
+   */
+  Event event_get(int index);
+
+  /**
+   * Returns how many events didn't fit in the buffer.
+   */
+  std::uint32_t dropped_get();
+
+  /**
+   * Empties the buffer.  Marks that are already underway are dropped.
+   */
+  void clear();
+
+  /**
+   * Prints every event to the terminal, with the time since the phase it's in started.
+   */
+  void print();
+
+  /**
+   * Writes what print() does to a file on the SD card.  Returns false without an SD card.
+   *
+   * \param path
+   *        file to write over, nullptr is /usd/timeline_<phase>.txt for the phase in the buffer
+   */
+  bool save(const char* path = nullptr);
+
+ private:
+  void record(const char* name, Kind kind);
+  void write(FILE* file);
+
+  Event events[MAX_EVENTS];
+  // The phase each event was written in, anything else is left over from an earlier one
+  std::atomic<std::uint32_t> written[MAX_EVENTS] = {};
+  std::atomic<int> count{0};
+  std::atomic<std::uint32_t> dropped{0};
+  std::atomic<std::uint32_t> phase{1};
+  std::atomic<const char*> phase_name{"startup"};
+
+  // Set by phase_begin(), cleared by the first tick / output
+  std::atomic<bool> tick_armed{false};
+  std::atomic<bool> output_armed{false};
+};
+
+extern Timeline timeline;
@@ -0,0 +1,158 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include "main.h"
+
+using namespace ez;
+
+void PID::timers_reset() {
+  i = 0;
+  k = 0;
+  j = 0;
+  l = 0;
+  is_mA = false;
+}
+
+PID::PID() {
+  output = 0;
+  prev_error = 0;
+  integral = 0;
+  time = 0;
+  prev_time = 0;
+  name_active = false;
+}
+
+PID::PID(double p, double i, double d, double start_i, std::string name) {
+  name_active = name == "" ? false : true;
+  constants_set(p, i, d, start_i);
+  name_set(name);
+}
+
+void PID::name_set(std::string p_name) {
+  name = p_name;
+  name_active = name == "" ? false : true;
+}
+
+std::string PID::name_get() { return name; }
+
+void PID::constants_set(double p, double i, double d, double p_start_i) {
+  constants.kp = p;
+  constants.ki = i;
+  constants.kd = d;
+  constants.start_i = p_start_i;
+}
+
+void PID::exit_condition_set(int p_small_exit_time, double p_small_error, int p_big_exit_time, double p_big_error, int p_velocity_exit_time, int p_mA_timeout) {
+  exit.small_exit_time = p_small_exit_time;
+  exit.small_error = p_small_error;
+  exit.big_exit_time = p_big_exit_time;
+  exit.big_error = p_big_error;
+  exit.velocity_exit_time = p_velocity_exit_time;
+  exit.mA_timeout = p_mA_timeout;
+}
+
+void PID::i_reset_toggle(bool toggle) { reset_i_sgn = toggle; }
+bool PID::i_reset_get() { return reset_i_sgn; }
+
+void PID::target_set(double input) { target = input; }
+double PID::target_get() { return target; }
+
+PID::Constants PID::constants_get() { return constants; }
+
+void PID::variables_reset() {
+  output = 0;
+  target = 0;
+  error = 0;
+  prev_error = 0;
+  integral = 0;
+  time = 0;
+  prev_time = 0;
+}
+
+double PID::compute(double current) {
+  error = target - current;
+  derivative = error - prev_error;
+
+  if (constants.ki != 0) {
+    if (fabs(error) < constants.start_i)
+      integral += error;
+
+    if (util::sgn(error) != util::sgn(prev_error) && reset_i_sgn)
+      integral = 0;
+  }
+
+  output = (error * constants.kp) + (integral * constants.ki) + (derivative * constants.kd);
+
+  prev_error = error;
+
+  return output;
+}
+
+void PID::exit_condition_print(ez::exit_output exit_type) {
+  std::cout << " ";
+  if (name_active)
+    std::cout << name << " PID " << exit_to_string(exit_type) << " Exit.\n";
+  else
+    std::cout << "PID " << exit_to_string(exit_type) << " Exit.\n";
+}
+
+exit_output PID::exit_condition(bool print) {
+  // If this function is called while all exit constants are 0, print an error
+  if (exit.small_error == 0 && exit.small_exit_time == 0 && exit.big_error == 0 && exit.big_exit_time == 0 && exit.velocity_exit_time == 0 && exit.mA_timeout == 0) {
+    exit_condition_print(ERROR_NO_CONSTANTS);
+    return ERROR_NO_CONSTANTS;
+  }
+
+  // If the robot gets within the target, make sure it's there for small_timeout amount of time
+  if (exit.small_error != 0) {
+    if (fabs(error) < exit.small_error) {
+      j += util::DELAY_TIME;
+      i = 0;  // While this is running, don't run big thresh
+      if (j > exit.small_exit_time) {
+        timers_reset();
+        if (print) exit_condition_print(SMALL_EXIT);
+        return SMALL_EXIT;
+      }
+    } else {
+      j = 0;
+    }
+  }
+
+  // If the robot is close to the target, start a timer.  If the robot doesn't get closer within
+  // a certain amount of time, exit and continue
+  if (exit.big_error != 0 && exit.big_exit_time != 0) {  // Check if this condition is enabled
+    if (fabs(error) < exit.big_error) {
+      i += util::DELAY_TIME;
+      if (i > exit.big_exit_time) {
+        timers_reset();
+        if (print) exit_condition_print(BIG_EXIT);
+        return BIG_EXIT;
+      }
+    } else {
+      i = 0;
+    }
+  }
+
+  // If the motor velocity is 0, the code will timeout and set interfered to true
+  if (exit.velocity_exit_time != 0) {  // Check if this condition is enabled
+    if (fabs(derivative) <= 0.05) {
+      k += util::DELAY_TIME;
+      if (k > exit.velocity_exit_time) {
+        timers_reset();
+        if (print) exit_condition_print(VELOCITY_EXIT);
+        return VELOCITY_EXIT;
+      }
+    } else {
+      k = 0;
+    }
+  }
+
+  return RUNNING;
+}
+
+exit_output PID::exit_condition(pros::Motor sensor, bool print) { return exit_condition(&sensor, 1, print); }
+
+exit_output PID::exit_condition(std::vector<pros::Motor> sensor, bool print) { return exit_condition(sensor.data(), sensor.size(), print); }
@@ -0,0 +1,243 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include "main.h"
+
+using namespace ez;
+
+// Constructor for integrated encoders
+Drive::Drive(std::vector<int> left_motor_ports, std::vector<int> right_motor_ports,
+             int imu_port, double wheel_diameter, double ticks, double ratio)
+    : imu(imu_port),
+      left_tracker(-1, -1, false),   // Default value
+      right_tracker(-1, -1, false),  // Default value
+      left_rotation(-1),
+      right_rotation(-1),
+      ez_auto([this] { this->ez_auto_task(); }) {
+  is_tracker = DRIVE_INTEGRATED;
+
+  // Set ports to a global vector
+  for (auto i : left_motor_ports) {
+    pros::Motor temp(abs(i), util::reversed_active(i));
+    left_motors.push_back(temp);
+  }
+  for (auto i : right_motor_ports) {
+    pros::Motor temp(abs(i), util::reversed_active(i));
+    right_motors.push_back(temp);
+  }
+
+  // A simulated motor's cartridge is whatever set_gearing says, and the tick math below is in counts
+  pros::motor_gearset_e_t gearset = ticks >= 600 ? pros::E_MOTOR_GEARSET_06 : ticks <= 100 ? pros::E_MOTOR_GEARSET_36 : pros::E_MOTOR_GEARSET_18;
+  for (auto& i : left_motors) {
+    i.set_gearing(gearset);
+    i.set_encoder_units(pros::E_MOTOR_ENCODER_COUNTS);
+  }
+  for (auto& i : right_motors) {
+    i.set_gearing(gearset);
+    i.set_encoder_units(pros::E_MOTOR_ENCODER_COUNTS);
+  }
+
+  // Set constants for tick_per_inch calculation
+  WHEEL_DIAMETER = wheel_diameter;
+  RATIO = ratio;
+  CARTRIDGE = ticks;
+  TICK_PER_INCH = drive_tick_per_inch();
+
+  drive_defaults_set();
+}
+
+void Drive::drive_defaults_set() {
+  // PID Constants
+  pid_heading_constants_set(3, 0, 20, 0);
+  pid_drive_constants_set(15, 0, 150);
+  pid_turn_constants_set(3, 0, 20);
+  pid_swing_constants_set(5, 0, 30);
+  pid_turn_min_set(30);
+  pid_swing_min_set(30);
+
+  // Exit conditions
+  pid_turn_exit_condition_set(80, 3, 250, 7, 500, 500);
+  pid_swing_exit_condition_set(80, 3, 250, 7, 500, 500);
+  pid_drive_exit_condition_set(80, 1, 250, 3, 500, 500);
+
+  // Joystick deadzone
+  opcontrol_joystick_threshold_set(5);
+
+  // Modify joystick curve on controller (defaults to disabled)
+  opcontrol_curve_buttons_toggle(true);
+
+  // Left / Right modify buttons
+  opcontrol_curve_buttons_left_set(pros::E_CONTROLLER_DIGITAL_LEFT, pros::E_CONTROLLER_DIGITAL_RIGHT);
+  opcontrol_curve_buttons_right_set(pros::E_CONTROLLER_DIGITAL_Y, pros::E_CONTROLLER_DIGITAL_A);
+
+  // Enable auto printing and drive motors moving
+  pid_drive_toggle(true);
+  pid_print_toggle(true);
+}
+
+double Drive::drive_tick_per_inch() {
+  CIRCUMFERENCE = WHEEL_DIAMETER * M_PI;
+
+  if (is_tracker == DRIVE_ADI_ENCODER || is_tracker == DRIVE_ROTATION)
+    TICK_PER_REV = CARTRIDGE * RATIO;
+  else
+    TICK_PER_REV = (50.0 * (3600.0 / CARTRIDGE)) * RATIO;  // with no cart, the encoder reads 50 counts per rotation
+
+  TICK_PER_INCH = (TICK_PER_REV / CIRCUMFERENCE);
+  return TICK_PER_INCH;
+}
+
+void Drive::drive_ratio_set(double ratio) { RATIO = ratio; }
+
+void Drive::private_drive_set(int left, int right) {
+  for (auto i : left_motors) {
+    if (!pto_check(i)) i.move_voltage(left * (12000.0 / 127.0));  // If the motor is in the pto list, don't do anything to the motor.
+  }
+  for (auto i : right_motors) {
+    if (!pto_check(i)) i.move_voltage(right * (12000.0 / 127.0));  // If the motor is in the pto list, don't do anything to the motor.
+  }
+}
+
+void Drive::drive_set(int left, int right) {
+  drive_mode_set(DISABLE);
+  private_drive_set(left, right);
+}
+
+std::vector<int> Drive::drive_get() {
+  int left = left_motors.front().get_voltage() / (12000.0 / 127.0);
+  int right = right_motors.front().get_voltage() / (12000.0 / 127.0);
+  return {left, right};
+}
+
+void Drive::drive_mode_set(e_mode p_mode) { mode = p_mode; }
+e_mode Drive::drive_mode_get() { return mode; }
+
+void Drive::pid_drive_toggle(bool toggle) { drive_toggle = toggle; }
+bool Drive::pid_drive_toggle_get() { return drive_toggle; }
+
+void Drive::pid_print_toggle(bool toggle) { print_toggle = toggle; }
+bool Drive::pid_print_toggle_get() { return print_toggle; }
+
+bool Drive::pto_check(pros::Motor check_if_pto) {
+  auto does_exist = std::find(pto_active.begin(), pto_active.end(), check_if_pto.get_port());
+  if (does_exist != pto_active.end())
+    return true;  // Motor is in the list
+  return false;   // Motor isn't in the list
+}
+
+void Drive::pto_add(std::vector<pros::Motor> pto_list) {
+  for (auto i : pto_list) {
+    // Return if the first index was used (this motor is used for sensing)
+    if (i.get_port() == left_motors[0].get_port() || i.get_port() == right_motors[0].get_port()) {
+      printf("You cannot PTO your first motor!\n");
+      return;
+    }
+    if (!pto_check(i)) pto_active.push_back(i.get_port());
+  }
+}
+
+void Drive::pto_remove(std::vector<pros::Motor> pto_list) {
+  for (auto i : pto_list) {
+    auto does_exist = std::find(pto_active.begin(), pto_active.end(), i.get_port());
+    if (does_exist != pto_active.end()) pto_active.erase(does_exist);
+  }
+}
+
+void Drive::pto_toggle(std::vector<pros::Motor> pto_list, bool toggle) {
+  if (toggle)
+    pto_add(pto_list);
+  else
+    pto_remove(pto_list);
+}
+
+// Motor telemetry
+void Drive::drive_sensor_reset() {
+  left_motors.front().tare_position();
+  right_motors.front().tare_position();
+}
+
+int Drive::drive_sensor_right_raw() { return right_motors.front().get_position(); }
+double Drive::drive_sensor_right() { return drive_sensor_right_raw() / drive_tick_per_inch(); }
+int Drive::drive_velocity_right() { return right_motors.front().get_actual_velocity(); }
+double Drive::drive_mA_right() { return right_motors.front().get_current_draw(); }
+bool Drive::drive_current_right_over() { return right_motors.front().is_over_current(); }
+
+int Drive::drive_sensor_left_raw() { return left_motors.front().get_position(); }
+double Drive::drive_sensor_left() { return drive_sensor_left_raw() / drive_tick_per_inch(); }
+int Drive::drive_velocity_left() { return left_motors.front().get_actual_velocity(); }
+double Drive::drive_mA_left() { return left_motors.front().get_current_draw(); }
+bool Drive::drive_current_left_over() { return left_motors.front().is_over_current(); }
+
+void Drive::drive_imu_reset(double new_heading) { imu.set_rotation(new_heading); }
+double Drive::drive_imu_get() { return imu.get_rotation(); }
+
+void Drive::drive_imu_display_loading(int iter) {
+  // If the lcd is already initialized, don't run this function
+  if (pros::lcd::is_initialized()) return;
+
+  // No brain screen, so print the loading bar to the terminal
+  if (iter == util::DELAY_TIME) printf("Calibrating IMU");
+  if (iter % 500 == 0) printf(".");
+  if (iter >= 2990) printf("\n");
+}
+
+bool Drive::drive_imu_calibrate(bool run_loading_animation) {
+  imu.reset();
+  int iter = 0;
+  while (true) {
+    iter += util::DELAY_TIME;
+
+    if (run_loading_animation) drive_imu_display_loading(iter);
+
+    if (iter >= 2000) {
+      if (!(imu.get_status() & pros::c::E_IMU_STATUS_CALIBRATING)) {
+        break;
+      }
+      if (iter >= 3000) {
+        printf("No IMU plugged in, (took %d ms to realize that)\n", iter);
+        return false;
+      }
+    }
+    pros::delay(util::DELAY_TIME);
+  }
+  master.rumble(".");
+  printf("IMU is done calibrating (took %d ms)\n", iter);
+  return true;
+}
+
+// Brake modes
+void Drive::drive_brake_set(pros::motor_brake_mode_e_t brake_type) {
+  CURRENT_BRAKE = brake_type;
+  for (auto i : left_motors) {
+    if (!pto_check(i)) i.set_brake_mode(brake_type);
+  }
+  for (auto i : right_motors) {
+    if (!pto_check(i)) i.set_brake_mode(brake_type);
+  }
+}
+
+pros::motor_brake_mode_e_t Drive::drive_brake_get() { return CURRENT_BRAKE; }
+
+void Drive::initialize() {
+  opcontrol_curve_sd_initialize();
+  drive_imu_calibrate();
+  drive_sensor_reset();
+}
+
+void Drive::drive_current_limit_set(int mA) {
+  if (abs(mA) > 2500) {
+    mA = 2500;
+  }
+  CURRENT_MA = mA;
+  for (auto i : left_motors) {
+    if (!pto_check(i)) i.set_current_limit(abs(mA));
+  }
+  for (auto i : right_motors) {
+    if (!pto_check(i)) i.set_current_limit(abs(mA));
+  }
+}
+
+int Drive::drive_current_limit_get() { return CURRENT_MA; }
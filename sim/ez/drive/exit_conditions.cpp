@@ -0,0 +1,213 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include "main.h"
+#include "motion_trace.hpp"
+#include "okapi/api/units/QAngle.hpp"
+#include "okapi/api/units/QLength.hpp"
+
+using namespace ez;
+
+// User wrapper for exit condition
+void Drive::pid_wait() {
+  if (motion_trace.wait_begin) motion_trace.wait_begin();
+  pros::delay(util::DELAY_TIME);
+
+  // Drive Exit
+  if (mode == DRIVE) {
+    exit_output left_exit = RUNNING;
+    exit_output right_exit = RUNNING;
+    while (left_exit == RUNNING || right_exit == RUNNING) {
+      left_exit = left_exit != RUNNING ? left_exit : leftPID.exit_condition(left_motors);
+      right_exit = right_exit != RUNNING ? right_exit : rightPID.exit_condition(right_motors);
+      pros::delay(util::DELAY_TIME);
+    }
+    if (print_toggle) std::cout << "  Left: " << exit_to_string(left_exit) << " Exit, error: " << leftPID.error << ".   Right: " << exit_to_string(right_exit) << " Exit, error: " << rightPID.error << ".\n";
+
+    if (left_exit == mA_EXIT || left_exit == VELOCITY_EXIT || right_exit == mA_EXIT || right_exit == VELOCITY_EXIT) {
+      interfered = true;
+    }
+    if (motion_trace.wait_end) motion_trace.wait_end(left_exit, right_exit);
+  }
+
+  // Turn Exit
+  else if (mode == TURN) {
+    exit_output turn_exit = RUNNING;
+    while (turn_exit == RUNNING) {
+      turn_exit = turn_exit != RUNNING ? turn_exit : turnPID.exit_condition({left_motors[0], right_motors[0]});
+      pros::delay(util::DELAY_TIME);
+    }
+    if (print_toggle) std::cout << "  Turn: " << exit_to_string(turn_exit) << " Exit, error: " << turnPID.error << ".\n";
+
+    if (turn_exit == mA_EXIT || turn_exit == VELOCITY_EXIT) {
+      interfered = true;
+    }
+    if (motion_trace.wait_end) motion_trace.wait_end(turn_exit, turn_exit);
+  }
+
+  // Swing Exit
+  else if (mode == SWING) {
+    exit_output swing_exit = RUNNING;
+    pros::Motor& sensor = current_swing == ez::LEFT_SWING ? left_motors[0] : right_motors[0];
+    while (swing_exit == RUNNING) {
+      swing_exit = swing_exit != RUNNING ? swing_exit : swingPID.exit_condition(sensor);
+      pros::delay(util::DELAY_TIME);
+    }
+    if (print_toggle) std::cout << "  Swing: " << exit_to_string(swing_exit) << " Exit, error: " << swingPID.error << ".\n";
+
+    if (swing_exit == mA_EXIT || swing_exit == VELOCITY_EXIT) {
+      interfered = true;
+    }
+    if (motion_trace.wait_end) motion_trace.wait_end(swing_exit, swing_exit);
+  }
+}
+
+// Function to wait until a certain position is reached.  Wrapper for exit condition.
+void Drive::wait_until_drive(double target) {
+  // If robot is driving...
+  if (mode == DRIVE) {
+    // Calculate error between current and target (target needs to be an in between position)
+    double l_tar = l_start + target;
+    double r_tar = r_start + target;
+    double l_error = l_tar - drive_sensor_left();
+    double r_error = r_tar - drive_sensor_right();
+    int l_sgn = util::sgn(l_error);
+    int r_sgn = util::sgn(r_error);
+
+    exit_output left_exit = RUNNING;
+    exit_output right_exit = RUNNING;
+
+    while (true) {
+      l_error = l_tar - drive_sensor_left();
+      r_error = r_tar - drive_sensor_right();
+
+      // Before robot has reached target, use the exit conditions to avoid getting stuck in this while loop
+      if (util::sgn(l_error) == l_sgn || util::sgn(r_error) == r_sgn) {
+        if (left_exit == RUNNING || right_exit == RUNNING) {
+          left_exit = left_exit != RUNNING ? left_exit : leftPID.exit_condition(left_motors);
+          right_exit = right_exit != RUNNING ? right_exit : rightPID.exit_condition(right_motors);
+          pros::delay(util::DELAY_TIME);
+        } else {
+          if (print_toggle) std::cout << "  Left: " << exit_to_string(left_exit) << " Wait Until Exit Failsafe, triggered at " << drive_sensor_left() - l_start << ".   Right: " << exit_to_string(right_exit) << " Wait Until Exit Failsafe, triggered at " << drive_sensor_right() - r_start << ".\n";
+
+          if (left_exit == mA_EXIT || left_exit == VELOCITY_EXIT || right_exit == mA_EXIT || right_exit == VELOCITY_EXIT) {
+            interfered = true;
+          }
+          return;
+        }
+      }
+      // Once we've past target, return
+      else if (util::sgn(l_error) != l_sgn || util::sgn(r_error) != r_sgn) {
+        if (print_toggle) std::cout << "  Drive Wait Until Exit Success, triggered at: L,R(" << drive_sensor_left() - l_start << ", " << drive_sensor_right() - r_start << ")\n";
+        return;
+      }
+    }
+  }
+
+  // Print error if this function is called while not driving
+  else {
+    if (print_toggle) printf("Use wait_until_turn_swing() for swings or turns!\n");
+  }
+}
+
+// Function to wait until a certain position is reached.  Wrapper for exit condition.
+void Drive::wait_until_turn_swing(double target) {
+  // If robot is turning or swinging...
+  if (mode == TURN || mode == SWING) {
+    // Calculate error between current and target (target needs to be an in between position)
+    double g_error = target - drive_imu_get();
+    int g_sgn = util::sgn(g_error);
+
+    exit_output turn_exit = RUNNING;
+    exit_output swing_exit = RUNNING;
+
+    pros::Motor& sensor = current_swing == ez::LEFT_SWING ? left_motors[0] : right_motors[0];
+
+    while (true) {
+      g_error = target - drive_imu_get();
+
+      // If turning...
+      if (mode == TURN) {
+        // Before robot has reached target, use the exit conditions to avoid getting stuck in this while loop
+        if (util::sgn(g_error) == g_sgn) {
+          if (turn_exit == RUNNING) {
+            turn_exit = turn_exit != RUNNING ? turn_exit : turnPID.exit_condition({left_motors[0], right_motors[0]});
+            pros::delay(util::DELAY_TIME);
+          } else {
+            if (print_toggle) std::cout << "  Turn: " << exit_to_string(turn_exit) << " Wait Until Exit Failsafe, triggered at " << drive_imu_get() << ".\n";
+
+            if (turn_exit == mA_EXIT || turn_exit == VELOCITY_EXIT) {
+              interfered = true;
+            }
+            return;
+          }
+        }
+        // Once we've past target, return
+        else if (util::sgn(g_error) != g_sgn) {
+          if (print_toggle) std::cout << "  Turn Wait Until Exit Success, triggered at " << drive_imu_get() << "\n";
+          return;
+        }
+      }
+
+      // If swinging...
+      else {
+        // Before robot has reached target, use the exit conditions to avoid getting stuck in this while loop
+        if (util::sgn(g_error) == g_sgn) {
+          if (swing_exit == RUNNING) {
+            swing_exit = swing_exit != RUNNING ? swing_exit : swingPID.exit_condition(sensor);
+            pros::delay(util::DELAY_TIME);
+          } else {
+            if (print_toggle) std::cout << "  Swing: " << exit_to_string(swing_exit) << " Wait Until Exit Failsafe, triggered at " << drive_imu_get() << ".\n";
+
+            if (swing_exit == mA_EXIT || swing_exit == VELOCITY_EXIT) {
+              interfered = true;
+            }
+            return;
+          }
+        }
+        // Once we've past target, return
+        else if (util::sgn(g_error) != g_sgn) {
+          if (print_toggle) std::cout << "  Swing Wait Until Exit Success, triggered at " << drive_imu_get() << "\n";
+          return;
+        }
+      }
+    }
+  }
+
+  // Print error if this function is called while not turning or swinging
+  else {
+    if (print_toggle) printf("Use wait_until_drive() for driving!\n");
+  }
+}
+
+void Drive::pid_wait_until(okapi::QLength target) {
+  // If robot is driving...
+  if (mode == DRIVE) {
+    wait_until_drive(target.convert(okapi::inch));
+  } else {
+    if (print_toggle) printf("QLength not supported for turn or swing!\n");
+  }
+}
+
+void Drive::pid_wait_until(okapi::QAngle target) {
+  // If robot is turning or swinging...
+  if (mode == TURN || mode == SWING) {
+    wait_until_turn_swing(target.convert(okapi::degree));
+  } else {
+    if (print_toggle) printf("QAngle not supported for drive!\n");
+  }
+}
+
+void Drive::pid_wait_until(double target) {
+  // If robot is driving...
+  if (mode == DRIVE) {
+    wait_until_drive(target);
+  }
+  // If robot is turning or swinging...
+  else if (mode == TURN || mode == SWING) {
+    wait_until_turn_swing(target);
+  }
+}
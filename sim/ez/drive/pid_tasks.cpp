@@ -0,0 +1,107 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include "main.h"
+
+using namespace ez;
+
+void Drive::ez_auto_task() {
+  while (true) {
+    // Autonomous PID
+    if (drive_mode_get() == DRIVE)
+      drive_pid_task();
+    else if (drive_mode_get() == TURN)
+      turn_pid_task();
+    else if (drive_mode_get() == SWING)
+      swing_pid_task();
+
+    if (pros::competition::is_autonomous() && !util::AUTON_RAN)
+      util::AUTON_RAN = true;
+    else if (!pros::competition::is_autonomous())
+      drive_mode_set(DISABLE);
+
+    pros::delay(util::DELAY_TIME);
+  }
+}
+
+// Drive PID task
+void Drive::drive_pid_task() {
+  // Compute PID
+  leftPID.compute(drive_sensor_left());
+  rightPID.compute(drive_sensor_right());
+  headingPID.compute(drive_imu_get());
+
+  // Compute slew
+  double l_slew_out = slew_left.iterate(drive_sensor_left());
+  double r_slew_out = slew_right.iterate(drive_sensor_right());
+
+  // Clip leftPID and rightPID to slew (if slew is disabled, it returns max_speed)
+  double l_drive_out = util::clamp(leftPID.output, l_slew_out, -l_slew_out);
+  double r_drive_out = util::clamp(rightPID.output, r_slew_out, -r_slew_out);
+
+  // Toggle heading
+  double gyro_out = heading_on ? headingPID.output : 0;
+
+  // Combine heading and drive
+  double l_out = l_drive_out + gyro_out;
+  double r_out = r_drive_out - gyro_out;
+
+  // Set motors
+  if (drive_toggle)
+    private_drive_set(l_out, r_out);
+}
+
+// Turn PID task
+void Drive::turn_pid_task() {
+  // Compute PID
+  turnPID.compute(drive_imu_get());
+
+  // Compute slew
+  double slew_out = slew_turn.iterate(drive_imu_get());
+
+  // Clip gyroPID to max speed
+  double gyro_out = util::clamp(turnPID.output, slew_out, -slew_out);
+
+  // Clip the speed of the turn when the robot is within StartI, only do this when target is larger then StartI
+  if (turnPID.constants.ki != 0 && (fabs(turnPID.target_get()) > turnPID.constants.start_i && fabs(turnPID.error) < turnPID.constants.start_i)) {
+    if (pid_turn_min_get() != 0)
+      gyro_out = util::clamp(gyro_out, pid_turn_min_get(), -pid_turn_min_get());
+  }
+
+  // Set motors
+  if (drive_toggle)
+    private_drive_set(gyro_out, -gyro_out);
+}
+
+// Swing PID task
+void Drive::swing_pid_task() {
+  // Compute PID
+  swingPID.compute(drive_imu_get());
+
+  // Compute slew
+  double current = slew_swing_using_angle ? drive_imu_get() : (current_swing == LEFT_SWING ? drive_sensor_left() : drive_sensor_right());
+  double slew_out = slew_swing.iterate(current);
+
+  // Clip swingPID to max speed
+  double swing_out = util::clamp(swingPID.output, slew_out, -slew_out);
+
+  // Clip the speed of the swing when the robot is within StartI, only do this when target is larger then StartI
+  if (swingPID.constants.ki != 0 && (fabs(swingPID.target_get()) > swingPID.constants.start_i && fabs(swingPID.error) < swingPID.constants.start_i)) {
+    if (pid_swing_min_get() != 0)
+      swing_out = util::clamp(swing_out, pid_swing_min_get(), -pid_swing_min_get());
+  }
+
+  // The opposite side follows the swinging side in the same direction, scaled so it slows down with it
+  double opposite_out = max_speed == 0 ? 0 : swing_opposite_speed * (swing_out / max_speed);
+
+  // Set motors
+  if (drive_toggle) {
+    if (current_swing == LEFT_SWING)
+      private_drive_set(swing_out, opposite_out);
+    else if (current_swing == RIGHT_SWING)
+      private_drive_set(-opposite_out, -swing_out);
+  }
+}
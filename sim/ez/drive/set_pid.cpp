@@ -0,0 +1,293 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include "main.h"
+#include "motion_trace.hpp"
+#include "okapi/api/units/QAngle.hpp"
+#include "okapi/api/units/QLength.hpp"
+#include "okapi/api/units/QTime.hpp"
+
+using namespace ez;
+
+// Constants
+void Drive::pid_heading_constants_set(double p, double i, double d, double p_start_i) {
+  headingPID.constants_set(p, i, d, p_start_i);
+}
+
+void Drive::pid_drive_constants_forward_set(double p, double i, double d, double p_start_i) {
+  forward_drivePID.constants_set(p, i, d, p_start_i);
+}
+
+void Drive::pid_drive_constants_backward_set(double p, double i, double d, double p_start_i) {
+  backward_drivePID.constants_set(p, i, d, p_start_i);
+}
+
+void Drive::pid_drive_constants_set(double p, double i, double d, double p_start_i) {
+  pid_drive_constants_forward_set(p, i, d, p_start_i);
+  pid_drive_constants_backward_set(p, i, d, p_start_i);
+}
+
+void Drive::pid_turn_constants_set(double p, double i, double d, double p_start_i) {
+  turnPID.constants_set(p, i, d, p_start_i);
+}
+
+void Drive::pid_swing_constants_forward_set(double p, double i, double d, double p_start_i) {
+  forward_swingPID.constants_set(p, i, d, p_start_i);
+}
+
+void Drive::pid_swing_constants_backward_set(double p, double i, double d, double p_start_i) {
+  backward_swingPID.constants_set(p, i, d, p_start_i);
+}
+
+void Drive::pid_swing_constants_set(double p, double i, double d, double p_start_i) {
+  pid_swing_constants_forward_set(p, i, d, p_start_i);
+  pid_swing_constants_backward_set(p, i, d, p_start_i);
+}
+
+PID::Constants Drive::pid_heading_constants_get() { return headingPID.constants_get(); }
+PID::Constants Drive::pid_drive_constants_forward_get() { return forward_drivePID.constants_get(); }
+PID::Constants Drive::pid_drive_constants_backward_get() { return backward_drivePID.constants_get(); }
+PID::Constants Drive::pid_drive_constants_get() { return forward_drivePID.constants_get(); }
+PID::Constants Drive::pid_turn_constants_get() { return turnPID.constants_get(); }
+PID::Constants Drive::pid_swing_constants_forward_get() { return forward_swingPID.constants_get(); }
+PID::Constants Drive::pid_swing_constants_backward_get() { return backward_swingPID.constants_get(); }
+PID::Constants Drive::pid_swing_constants_get() { return forward_swingPID.constants_get(); }
+
+void Drive::pid_turn_min_set(int min) { turn_min = abs(min); }
+int Drive::pid_turn_min_get() { return turn_min; }
+
+void Drive::pid_swing_min_set(int min) { swing_min = abs(min); }
+int Drive::pid_swing_min_get() { return swing_min; }
+
+// Exit conditions
+void Drive::pid_drive_exit_condition_set(int p_small_exit_time, double p_small_error, int p_big_exit_time, double p_big_error, int p_velocity_exit_time, int p_mA_timeout) {
+  leftPID.exit_condition_set(p_small_exit_time, p_small_error, p_big_exit_time, p_big_error, p_velocity_exit_time, p_mA_timeout);
+  rightPID.exit_condition_set(p_small_exit_time, p_small_error, p_big_exit_time, p_big_error, p_velocity_exit_time, p_mA_timeout);
+}
+
+void Drive::pid_turn_exit_condition_set(int p_small_exit_time, double p_small_error, int p_big_exit_time, double p_big_error, int p_velocity_exit_time, int p_mA_timeout) {
+  turnPID.exit_condition_set(p_small_exit_time, p_small_error, p_big_exit_time, p_big_error, p_velocity_exit_time, p_mA_timeout);
+}
+
+void Drive::pid_swing_exit_condition_set(int p_small_exit_time, double p_small_error, int p_big_exit_time, double p_big_error, int p_velocity_exit_time, int p_mA_timeout) {
+  swingPID.exit_condition_set(p_small_exit_time, p_small_error, p_big_exit_time, p_big_error, p_velocity_exit_time, p_mA_timeout);
+}
+
+void Drive::pid_drive_exit_condition_set(okapi::QTime p_small_exit_time, okapi::QLength p_small_error, okapi::QTime p_big_exit_time, okapi::QLength p_big_error, okapi::QTime p_velocity_exit_time, okapi::QTime p_mA_timeout) {
+  pid_drive_exit_condition_set(p_small_exit_time.convert(okapi::millisecond), p_small_error.convert(okapi::inch), p_big_exit_time.convert(okapi::millisecond), p_big_error.convert(okapi::inch), p_velocity_exit_time.convert(okapi::millisecond), p_mA_timeout.convert(okapi::millisecond));
+}
+
+void Drive::pid_turn_exit_condition_set(okapi::QTime p_small_exit_time, okapi::QAngle p_small_error, okapi::QTime p_big_exit_time, okapi::QAngle p_big_error, okapi::QTime p_velocity_exit_time, okapi::QTime p_mA_timeout) {
+  pid_turn_exit_condition_set(p_small_exit_time.convert(okapi::millisecond), p_small_error.convert(okapi::degree), p_big_exit_time.convert(okapi::millisecond), p_big_error.convert(okapi::degree), p_velocity_exit_time.convert(okapi::millisecond), p_mA_timeout.convert(okapi::millisecond));
+}
+
+void Drive::pid_swing_exit_condition_set(okapi::QTime p_small_exit_time, okapi::QAngle p_small_error, okapi::QTime p_big_exit_time, okapi::QAngle p_big_error, okapi::QTime p_velocity_exit_time, okapi::QTime p_mA_timeout) {
+  pid_swing_exit_condition_set(p_small_exit_time.convert(okapi::millisecond), p_small_error.convert(okapi::degree), p_big_exit_time.convert(okapi::millisecond), p_big_error.convert(okapi::degree), p_velocity_exit_time.convert(okapi::millisecond), p_mA_timeout.convert(okapi::millisecond));
+}
+
+// Slew
+void Drive::slew_drive_constants_forward_set(okapi::QLength distance, int min_speed) {
+  slew_forward.constants_set(distance.convert(okapi::inch), min_speed);
+}
+
+void Drive::slew_drive_constants_backward_set(okapi::QLength distance, int min_speed) {
+  slew_backward.constants_set(distance.convert(okapi::inch), min_speed);
+}
+
+void Drive::slew_drive_constants_set(okapi::QLength distance, int min_speed) {
+  slew_drive_constants_forward_set(distance, min_speed);
+  slew_drive_constants_backward_set(distance, min_speed);
+}
+
+void Drive::slew_turn_constants_set(okapi::QAngle distance, int min_speed) {
+  slew_turn.constants_set(distance.convert(okapi::degree), min_speed);
+}
+
+void Drive::slew_swing_constants_forward_set(okapi::QAngle distance, int min_speed) {
+  slew_swing_forward.constants_set(distance.convert(okapi::degree), min_speed);
+  slew_swing_fwd_using_angle = true;
+}
+
+void Drive::slew_swing_constants_backward_set(okapi::QAngle distance, int min_speed) {
+  slew_swing_backward.constants_set(distance.convert(okapi::degree), min_speed);
+  slew_swing_rev_using_angle = true;
+}
+
+void Drive::slew_swing_constants_set(okapi::QAngle distance, int min_speed) {
+  slew_swing_constants_forward_set(distance, min_speed);
+  slew_swing_constants_backward_set(distance, min_speed);
+}
+
+void Drive::slew_swing_constants_forward_set(okapi::QLength distance, int min_speed) {
+  slew_swing_forward.constants_set(distance.convert(okapi::inch), min_speed);
+  slew_swing_fwd_using_angle = false;
+}
+
+void Drive::slew_swing_constants_backward_set(okapi::QLength distance, int min_speed) {
+  slew_swing_backward.constants_set(distance.convert(okapi::inch), min_speed);
+  slew_swing_rev_using_angle = false;
+}
+
+void Drive::slew_swing_constants_set(okapi::QLength distance, int min_speed) {
+  slew_swing_constants_forward_set(distance, min_speed);
+  slew_swing_constants_backward_set(distance, min_speed);
+}
+
+// Motions
+void Drive::pid_targets_reset() {
+  headingPID.target_set(0);
+  leftPID.target_set(0);
+  rightPID.target_set(0);
+  forward_drivePID.target_set(0);
+  backward_drivePID.target_set(0);
+  turnPID.target_set(0);
+  swingPID.target_set(0);
+}
+
+void Drive::drive_angle_set(double angle) {
+  headingPID.target_set(angle);
+  imu.set_rotation(angle);
+}
+
+void Drive::drive_angle_set(okapi::QAngle p_angle) { drive_angle_set(p_angle.convert(okapi::degree)); }
+
+void Drive::pid_speed_max_set(int speed) { max_speed = abs(util::clamp(speed, 127, -127)); }
+int Drive::pid_speed_max_get() { return max_speed; }
+
+void Drive::pid_drive_set(double target, int speed, bool slew_on, bool toggle_heading) {
+  TICK_PER_INCH = drive_tick_per_inch();
+
+  // Print targets
+  if (print_toggle) printf("Drive Started... Target Value: %f", target);
+  if (slew_on && print_toggle) printf(" with slew");
+  if (print_toggle) printf("\n");
+
+  // Global setup
+  pid_speed_max_set(speed);
+  heading_on = toggle_heading;
+  bool is_backwards = false;
+  l_start = drive_sensor_left();
+  r_start = drive_sensor_right();
+
+  double l_target_encoder, r_target_encoder;
+
+  // Figure actual target value
+  l_target_encoder = l_start + target;
+  r_target_encoder = r_start + target;
+
+  // Figure out if going forward or backward
+  if (l_target_encoder < l_start && r_target_encoder < r_start) {
+    is_backwards = true;
+  }
+
+  // Set constants and slew
+  ez::slew* slew = &slew_forward;
+  if (!is_backwards) {
+    leftPID.constants_set(forward_drivePID.constants.kp, forward_drivePID.constants.ki, forward_drivePID.constants.kd, forward_drivePID.constants.start_i);
+    rightPID.constants_set(forward_drivePID.constants.kp, forward_drivePID.constants.ki, forward_drivePID.constants.kd, forward_drivePID.constants.start_i);
+  } else {
+    leftPID.constants_set(backward_drivePID.constants.kp, backward_drivePID.constants.ki, backward_drivePID.constants.kd, backward_drivePID.constants.start_i);
+    rightPID.constants_set(backward_drivePID.constants.kp, backward_drivePID.constants.ki, backward_drivePID.constants.kd, backward_drivePID.constants.start_i);
+    slew = &slew_backward;
+  }
+  slew_left.constants_set(slew->constants.distance_to_travel, slew->constants.min_speed);
+  slew_right.constants_set(slew->constants.distance_to_travel, slew->constants.min_speed);
+
+  // Set PID targets
+  leftPID.target_set(l_target_encoder);
+  rightPID.target_set(r_target_encoder);
+
+  // Initialize slew
+  slew_left.initialize(slew_on, max_speed, l_target_encoder, drive_sensor_left());
+  slew_right.initialize(slew_on, max_speed, r_target_encoder, drive_sensor_right());
+
+  // Run task
+  drive_mode_set(DRIVE);
+  if (motion_trace.motion_start) motion_trace.motion_start(DRIVE, target);
+}
+
+void Drive::pid_drive_set(okapi::QLength p_target, int speed, bool slew_on, bool toggle_heading) {
+  pid_drive_set(p_target.convert(okapi::inch), speed, slew_on, toggle_heading);
+}
+
+void Drive::pid_turn_set(double target, int speed, bool slew_on) {
+  // Print targets
+  if (print_toggle) printf("Turn Started... Target Value: %f\n", target);
+
+  // Set PID targets
+  turnPID.target_set(target);
+  headingPID.target_set(target);  // Update heading target for next drive motion
+  pid_speed_max_set(speed);
+
+  // Initialize slew
+  slew_turn.initialize(slew_on, max_speed, target, drive_imu_get());
+
+  // Run task
+  drive_mode_set(TURN);
+  if (motion_trace.motion_start) motion_trace.motion_start(TURN, target);
+}
+
+void Drive::pid_turn_set(okapi::QAngle p_target, int speed, bool slew_on) {
+  pid_turn_set(p_target.convert(okapi::degree), speed, slew_on);
+}
+
+void Drive::pid_turn_relative_set(double target, int speed, bool slew_on) {
+  pid_turn_set(headingPID.target_get() + target, speed, slew_on);
+}
+
+void Drive::pid_turn_relative_set(okapi::QAngle p_target, int speed, bool slew_on) {
+  pid_turn_relative_set(p_target.convert(okapi::degree), speed, slew_on);
+}
+
+void Drive::pid_swing_set(e_swing type, double target, int speed, int opposite_speed, bool slew_on) {
+  // Print targets
+  if (print_toggle) printf("Swing Started... Target Value: %f\n", target);
+  current_swing = type;
+  swing_opposite_speed = opposite_speed;
+
+  // Figure out if going forward or backward
+  int side = type == LEFT_SWING ? 1 : -1;
+  int direction = util::sgn((target - drive_imu_get()) * side);
+
+  // Set constants and slew
+  PID* constants = direction == -1 ? &backward_swingPID : &forward_swingPID;
+  swingPID.constants_set(constants->constants.kp, constants->constants.ki, constants->constants.kd, constants->constants.start_i);
+  ez::slew* slew = direction == -1 ? &slew_swing_backward : &slew_swing_forward;
+  slew_swing.constants_set(slew->constants.distance_to_travel, slew->constants.min_speed);
+  slew_swing_using_angle = direction == -1 ? slew_swing_rev_using_angle : slew_swing_fwd_using_angle;
+
+  // Set PID targets
+  swingPID.target_set(target);
+  headingPID.target_set(target);  // Update heading target for next drive motion
+  pid_speed_max_set(speed);
+
+  // Initialize slew
+  l_start = drive_sensor_left();
+  r_start = drive_sensor_right();
+  if (slew_swing_using_angle) {
+    slew_swing.initialize(slew_on, max_speed, target, drive_imu_get());
+  } else {
+    // Slew by distance on the swinging side.  Only the sign of the target matters, the distance comes from the constants
+    double start = type == LEFT_SWING ? l_start : r_start;
+    slew_swing.initialize(slew_on, max_speed, start + direction, start);
+  }
+
+  // Run task
+  drive_mode_set(SWING);
+  if (motion_trace.motion_start) motion_trace.motion_start(SWING, target);
+}
+
+void Drive::pid_swing_set(e_swing type, okapi::QAngle p_target, int speed, int opposite_speed, bool slew_on) {
+  pid_swing_set(type, p_target.convert(okapi::degree), speed, opposite_speed, slew_on);
+}
+
+void Drive::pid_swing_relative_set(e_swing type, double target, int speed, int opposite_speed, bool slew_on) {
+  pid_swing_set(type, headingPID.target_get() + target, speed, opposite_speed, slew_on);
+}
+
+void Drive::pid_swing_relative_set(e_swing type, okapi::QAngle p_target, int speed, int opposite_speed, bool slew_on) {
+  pid_swing_relative_set(type, p_target.convert(okapi::degree), speed, opposite_speed, slew_on);
+}
@@ -0,0 +1,237 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include "main.h"
+
+using namespace ez;
+
+// There is no SD card in the simulation, so curves start at their defaults
+void Drive::opcontrol_curve_sd_initialize() {}
+void Drive::save_l_curve_sd() {}
+void Drive::save_r_curve_sd() {}
+
+// Set curve defaults
+void Drive::opcontrol_curve_default_set(double left, double right) {
+  left_curve_scale = left;
+  right_curve_scale = right;
+}
+
+std::vector<double> Drive::opcontrol_curve_default_get() { return {left_curve_scale, right_curve_scale}; }
+
+// Set active brake
+void Drive::opcontrol_drive_activebrake_set(double kp) { active_brake_kp = kp; }
+double Drive::opcontrol_drive_activebrake_get() { return active_brake_kp; }
+
+// Set controller curve toggle
+void Drive::opcontrol_curve_buttons_toggle(bool toggle) { disable_controller = toggle; }
+bool Drive::opcontrol_curve_buttons_toggle_get() { return disable_controller; }
+
+// Set practice mode
+void Drive::opcontrol_joystick_practicemode_toggle(bool toggle) { practice_mode_is_on = toggle; }
+bool Drive::opcontrol_joystick_practicemode_toggle_get() { return practice_mode_is_on; }
+
+// Reverse drive
+void Drive::opcontrol_drive_reverse_set(bool toggle) { is_reversed = toggle; }
+bool Drive::opcontrol_drive_reverse_get() { return is_reversed; }
+
+// Joystick threshold
+void Drive::opcontrol_joystick_threshold_set(int threshold) { JOYSTICK_THRESHOLD = abs(threshold); }
+int Drive::opcontrol_joystick_threshold_get() { return JOYSTICK_THRESHOLD; }
+
+void Drive::opcontrol_curve_buttons_left_set(pros::controller_digital_e_t decrease, pros::controller_digital_e_t increase) {
+  l_increase_.button = increase;
+  l_decrease_.button = decrease;
+}
+
+std::vector<pros::controller_digital_e_t> Drive::opcontrol_curve_buttons_left_get() { return {l_decrease_.button, l_increase_.button}; }
+
+void Drive::opcontrol_curve_buttons_right_set(pros::controller_digital_e_t decrease, pros::controller_digital_e_t increase) {
+  r_increase_.button = increase;
+  r_decrease_.button = decrease;
+}
+
+std::vector<pros::controller_digital_e_t> Drive::opcontrol_curve_buttons_right_get() { return {r_decrease_.button, r_increase_.button}; }
+
+// Increase / decrease left and right curves
+void Drive::l_increase() { left_curve_scale += 0.1; }
+void Drive::l_decrease() {
+  left_curve_scale -= 0.1;
+  left_curve_scale = left_curve_scale < 0 ? 0 : left_curve_scale;
+}
+void Drive::r_increase() { right_curve_scale += 0.1; }
+void Drive::r_decrease() {
+  right_curve_scale -= 0.1;
+  right_curve_scale = right_curve_scale < 0 ? 0 : right_curve_scale;
+}
+
+// Button press logic for increase/decrease curves
+void Drive::button_press(button_* input_name, int button, std::function<void()> change_curve, std::function<void()> save) {
+  // If button is pressed, increase the curve and set toggles.
+  if (button && !input_name->lock) {
+    change_curve();
+    input_name->lock = true;
+    input_name->release_reset = true;
+  }
+
+  // If the button is still held, check if it's held for 500ms.
+  // Then, increase the curve every 100ms by 0.1
+  else if (button && input_name->lock) {
+    input_name->hold_timer += util::DELAY_TIME;
+    if (input_name->hold_timer > 500.0) {
+      input_name->increase_timer += util::DELAY_TIME;
+      if (input_name->increase_timer > 100.0) {
+        change_curve();
+        input_name->increase_timer = 0;
+      }
+    }
+  }
+
+  // When button is released for 250ms, save the new curve value to the SD card
+  else if (!button) {
+    input_name->lock = false;
+    input_name->hold_timer = 0;
+
+    if (input_name->release_reset) {
+      input_name->release_timer += util::DELAY_TIME;
+      if (input_name->release_timer > 250.0) {
+        save();
+        input_name->release_timer = 0;
+        input_name->release_reset = false;
+      }
+    }
+  }
+}
+
+// Function to change curves while the robot is still
+void Drive::opcontrol_curve_buttons_iterate() {
+  if (!disable_controller) return;  // True enables, false disables.
+
+  button_press(&l_increase_, master.get_digital(l_increase_.button), ([this] { this->l_increase(); }), ([this] { this->save_l_curve_sd(); }));
+  button_press(&l_decrease_, master.get_digital(l_decrease_.button), ([this] { this->l_decrease(); }), ([this] { this->save_l_curve_sd(); }));
+  if (!is_tank) {
+    button_press(&r_increase_, master.get_digital(r_increase_.button), ([this] { this->r_increase(); }), ([this] { this->save_r_curve_sd(); }));
+    button_press(&r_decrease_, master.get_digital(r_decrease_.button), ([this] { this->r_decrease(); }), ([this] { this->save_r_curve_sd(); }));
+  }
+}
+
+// Left curve function
+double Drive::opcontrol_curve_left(double x) {
+  if (left_curve_scale != 0) {
+    // if (CURVE_TYPE)
+    return (powf(2.718, -(left_curve_scale / 10)) + powf(2.718, (fabs(x) - 127) / 10) * (1 - powf(2.718, -(left_curve_scale / 10)))) * x;
+    // else
+    // return powf(2.718, ((abs(x)-127)*RIGHT_CURVE_SCALE)/100)*x;
+  }
+  return x;
+}
+
+// Right curve function
+double Drive::opcontrol_curve_right(double x) {
+  if (right_curve_scale != 0) {
+    // if (CURVE_TYPE)
+    return (powf(2.718, -(right_curve_scale / 10)) + powf(2.718, (fabs(x) - 127) / 10) * (1 - powf(2.718, -(right_curve_scale / 10)))) * x;
+    // else
+    // return powf(2.718, ((abs(x)-127)*RIGHT_CURVE_SCALE)/100)*x;
+  }
+  return x;
+}
+
+// Practice mode
+int Drive::clipped_joystick(int joystick) {
+  if (practice_mode_is_on && (abs(joystick) > 127 - JOYSTICK_THRESHOLD)) joystick = 0;
+  return joystick;
+}
+
+void Drive::opcontrol_joystick_threshold_iterate(int l_stick, int r_stick) {
+  // Check the motors aren't in active brake when the joysticks are moving
+  if (abs(l_stick) > JOYSTICK_THRESHOLD || abs(r_stick) > JOYSTICK_THRESHOLD) {
+    if (is_reversed) {
+      private_drive_set(-r_stick, -l_stick);
+    } else {
+      private_drive_set(l_stick, r_stick);
+    }
+    if (active_brake_kp != 0) drive_sensor_reset();
+  }
+  // When joys are released, run active brake (P) on drive
+  else {
+    private_drive_set((0 - drive_sensor_left()) * active_brake_kp, (0 - drive_sensor_right()) * active_brake_kp);
+  }
+}
+
+// Clear the drive sensors when switching from autonomous to opcontrol
+void Drive::opcontrol_drive_sensors_reset() {
+  if (util::AUTON_RAN) {
+    drive_sensor_reset();
+    util::AUTON_RAN = false;
+  }
+}
+
+// Tank control
+void Drive::opcontrol_tank() {
+  is_tank = true;
+  opcontrol_drive_sensors_reset();
+
+  // Toggle for controller curve
+  opcontrol_curve_buttons_iterate();
+
+  auto analog_left_value = master.get_analog(ANALOG_LEFT_Y);
+  auto analog_right_value = master.get_analog(ANALOG_RIGHT_Y);
+
+  // Put the joysticks through the curve function
+  int l_stick = opcontrol_curve_left(clipped_joystick(analog_left_value));
+  int r_stick = opcontrol_curve_left(clipped_joystick(analog_right_value));
+
+  // Set robot to l_stick and r_stick, check joystick threshold, set active brake
+  opcontrol_joystick_threshold_iterate(l_stick, r_stick);
+}
+
+// Arcade standard
+void Drive::opcontrol_arcade_standard(e_type stick_type) {
+  is_tank = false;
+  opcontrol_drive_sensors_reset();
+
+  // Toggle for controller curve
+  opcontrol_curve_buttons_iterate();
+
+  int fwd_stick, turn_stick;
+  // Check arcade type (split vs single, normal vs flipped)
+  if (stick_type == SPLIT) {
+    // Put the joysticks through the curve function
+    fwd_stick = opcontrol_curve_left(clipped_joystick(master.get_analog(ANALOG_LEFT_Y)));
+    turn_stick = opcontrol_curve_right(clipped_joystick(master.get_analog(ANALOG_RIGHT_X)));
+  } else {
+    // Put the joysticks through the curve function
+    fwd_stick = opcontrol_curve_left(clipped_joystick(master.get_analog(ANALOG_LEFT_Y)));
+    turn_stick = opcontrol_curve_right(clipped_joystick(master.get_analog(ANALOG_LEFT_X)));
+  }
+
+  // Set robot to l_stick and r_stick, check joystick threshold, set active brake
+  opcontrol_joystick_threshold_iterate(fwd_stick + turn_stick, fwd_stick - turn_stick);
+}
+
+// Arcade control flipped
+void Drive::opcontrol_arcade_flipped(e_type stick_type) {
+  is_tank = false;
+  opcontrol_drive_sensors_reset();
+
+  // Toggle for controller curve
+  opcontrol_curve_buttons_iterate();
+
+  int turn_stick, fwd_stick;
+  // Check arcade type (split vs single, normal vs flipped)
+  if (stick_type == SPLIT) {
+    // Put the joysticks through the curve function
+    fwd_stick = opcontrol_curve_right(clipped_joystick(master.get_analog(ANALOG_RIGHT_Y)));
+    turn_stick = opcontrol_curve_left(clipped_joystick(master.get_analog(ANALOG_LEFT_X)));
+  } else {
+    // Put the joysticks through the curve function
+    fwd_stick = opcontrol_curve_right(clipped_joystick(master.get_analog(ANALOG_RIGHT_Y)));
+    turn_stick = opcontrol_curve_left(clipped_joystick(master.get_analog(ANALOG_RIGHT_X)));
+  }
+
+  // Set robot to l_stick and r_stick, check joystick threshold, set active brake
+  opcontrol_joystick_threshold_iterate(fwd_stick + turn_stick, fwd_stick - turn_stick);
+}
@@ -0,0 +1,48 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include "main.h"
+
+namespace ez::as {
+AutonSelector auton_selector{};
+bool turn_off = false;
+
+// There is no SD card in the simulation, so the selector always starts on the first page
+void page_up() {
+  if (auton_selector.auton_page_current == auton_selector.auton_count - 1)
+    auton_selector.auton_page_current = 0;
+  else
+    auton_selector.auton_page_current++;
+  auton_selector.selected_auton_print();
+}
+
+void page_down() {
+  if (auton_selector.auton_page_current == 0)
+    auton_selector.auton_page_current = auton_selector.auton_count - 1;
+  else
+    auton_selector.auton_page_current--;
+  auton_selector.selected_auton_print();
+}
+
+void initialize() {
+  // Initialize auto selector and LLEMU
+  pros::lcd::initialize();
+  auton_selector.selected_auton_print();
+
+  // Callbacks for auto selector
+  pros::lcd::register_btn0_cb(page_down);
+  pros::lcd::register_btn2_cb(page_up);
+}
+
+bool enabled() { return !turn_off; }
+
+void shutdown() {
+  turn_off = true;
+  pros::lcd::shutdown();
+  pros::lcd::register_btn0_cb(nullptr);
+  pros::lcd::register_btn2_cb(nullptr);
+}
+}  // namespace ez::as
@@ -0,0 +1,55 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include "main.h"
+
+using namespace ez;
+
+slew::slew() {}
+
+slew::slew(double distance, int minimum_speed) { constants_set(distance, minimum_speed); }
+
+void slew::constants_set(double distance, int minimum_speed) {
+  constants.distance_to_travel = distance;
+  constants.min_speed = minimum_speed;
+}
+
+slew::Constants slew::constants_get() { return constants; }
+
+void slew::initialize(bool enabled, double maximum_speed, double target, double current) {
+  is_enabled = enabled;
+  max_speed = maximum_speed;
+
+  sign = util::sgn(target - current);
+  x_intercept = current + (constants.distance_to_travel * sign);
+  y_intercept = max_speed * sign;
+  slope = ((sign * constants.min_speed) - y_intercept) / (x_intercept - 0 - current);
+}
+
+double slew::iterate(double current) {
+  // Ramp up the speed until the slew distance is traveled
+  if (is_enabled) {
+    error = x_intercept - current;
+
+    // When the sign of error flips, slew is completed
+    if (util::sgn(error) != sign)
+      is_enabled = false;
+
+    // Return slew speed
+    else if (util::sgn(error) == sign) {
+      last_output = ((slope * error) + y_intercept) * sign;
+      return last_output;
+    }
+  }
+
+  // When slew is completed, return max speed
+  last_output = max_speed;
+  return max_speed;
+}
+
+bool slew::enabled() { return is_enabled; }
+
+double slew::output() { return last_output; }
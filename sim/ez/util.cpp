@@ -0,0 +1,87 @@
+/*
+This Source Code Form is subject to the terms of the Mozilla Public
+License, v. 2.0. If a copy of the MPL was not distributed with this
+file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include "main.h"
+
+pros::Controller master(pros::E_CONTROLLER_MASTER);
+
+namespace ez {
+
+void ez_template_print() {
+  std::cout << "\n\n"
+               "EZ-Template (host simulation)\n"
+               "  https://ez-robotics.github.io/EZ-Template/\n\n";
+}
+
+void screen_print(std::string text, int line) {
+  int CurrAutoLine = line;
+  std::vector<string> texts = {};
+  std::string temp = "";
+
+  for (int i = 0; i < (int)text.length(); i++) {
+    if (text[i] != '\n' && temp.length() + 1 > 32) {
+      texts.push_back(temp);
+      temp = text[i];
+    } else if (text[i] == '\n') {
+      texts.push_back(temp);
+      temp = "";
+    } else {
+      temp += text[i];
+    }
+    if (i == (int)text.length() - 1) texts.push_back(temp);
+  }
+  for (auto i : texts) {
+    if (CurrAutoLine > 7) {
+      pros::lcd::clear();
+      pros::lcd::set_text(line, "Out of Bounds. Print Line is too far");
+      return;
+    }
+    pros::lcd::clear_line(CurrAutoLine);
+    pros::lcd::set_text(CurrAutoLine, i);
+    CurrAutoLine++;
+  }
+}
+
+std::string exit_to_string(exit_output input) {
+  switch ((int)input) {
+    case RUNNING:
+      return "Running";
+    case SMALL_EXIT:
+      return "Small";
+    case BIG_EXIT:
+      return "Big";
+    case VELOCITY_EXIT:
+      return "Velocity";
+    case mA_EXIT:
+      return "mA";
+    case ERROR_NO_CONSTANTS:
+      return "Error: Exit condition constants not set!";
+    default:
+      return "Error: Out of bounds!";
+  }
+}
+
+namespace util {
+bool AUTON_RAN = true;
+
+bool reversed_active(double input) {
+  if (input < 0) return true;
+  return false;
+}
+
+int sgn(double input) {
+  if (input > 0) return 1;
+  if (input < 0) return -1;
+  return 0;
+}
+
+double clamp(double input, double max, double min) {
+  if (input > max) return max;
+  if (input < min) return min;
+  return input;
+}
+}  // namespace util
+}  // namespace ez
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+#include "pros/rtos.h"
+#include "sim/tank_plant.hpp"
+
+namespace sim {
+
+/**
+ * Builds a TankPlant from chassis' drive motors and adds it.
+ */
+TankPlant& chassis_plant_add();
+
+/**
+ * Runs a competition period in its own task, like the PROS daemon does, and sets the
+ * competition status while it runs.  Returns false if the period was still running after
+ * time ms, in which case the task is removed.
+ *
+ * \param started
+ *        called with the new task before it first runs
+ */
+bool period_run(void (*period)(), const char* name, std::uint8_t status, std::uint32_t time, std::function<void(pros::task_t)> started = nullptr);
+
+}  // namespace sim
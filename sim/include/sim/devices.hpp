@@ -0,0 +1,158 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace sim {
+
+/**
+ * Smart devices refresh their readings on the brain every 10 ms, and a motor command
+ * lands on the motor about 5 ms after it is sent.
+ */
+constexpr std::uint32_t MOTOR_UPDATE_MS = 10;
+constexpr std::uint32_t MOTOR_COMMAND_LATENCY_MS = 5;
+constexpr std::uint32_t IMU_UPDATE_MS = 10;
+constexpr std::uint32_t IMU_CALIBRATION_MS = 1800;
+
+/**
+ * Virtual time each device call takes on the brain, in microseconds.
+ */
+constexpr std::uint32_t DEVICE_CALL_US = 2;
+
+/**
+ * V5 smart motor.  Positions are degrees and velocities rpm of the output shaft, as
+ * seen by the motor (before reversing).
+ */
+struct Motor {
+  bool used = false;
+  bool reversed = false;
+  int gearset = 1;
+  int encoder_units = 0;
+  int brake_mode = 0;
+  std::int32_t current_limit = 2500;
+
+  // Command, applied MOTOR_COMMAND_LATENCY_MS after it was sent.  In velocity and position
+  // mode the motor's own controller sets the voltage every tick
+  enum Mode { VOLTAGE, VELOCITY, POSITION };
+  Mode mode = VOLTAGE;
+  double target_velocity = 0;
+  double target_position = 0;
+  std::int32_t voltage = 0;
+  std::int32_t pending_voltage = 0;
+  std::uint32_t pending_time = 0;
+  bool pending = false;
+
+  // True state
+  double position = 0;
+  double velocity = 0;
+  double current = 0;
+  double temperature = 25;
+  bool driven = false;  // true when a plant owns position and velocity
+
+  // What the brain reads, refreshed every MOTOR_UPDATE_MS
+  double zero = 0;
+  double reported_position = 0;
+  double reported_velocity = 0;
+  std::int32_t reported_current = 0;
+  double reported_temperature = 25;
+  std::uint32_t reported_time = 0;
+
+  /**
+   * Free speed of the cartridge in rpm.
+   */
+  double free_rpm() const;
+
+  /**
+   * Encoder counts per output shaft revolution.
+   */
+  double counts_per_rev() const;
+
+  /**
+   * Voltage applied to the motor right now, in volts, positive spins the shaft forward.
+   */
+  double volts() const;
+};
+
+/**
+ * V5 inertial sensor.  rotation is continuous degrees, clockwise positive.
+ */
+struct Imu {
+  bool used = false;
+  double rotation = 0;
+  double rate = 0;
+  double offset = 0;
+  double reported_rotation = 0;
+  double reported_rate = 0;
+  double noise = 0;  // standard deviation of each reading, degrees
+  std::uint32_t calibrate_until = 0;
+  std::uint32_t reported_time = 0;
+};
+
+/**
+ * 3 wire port output.  Every change is logged.
+ */
+struct AdiOut {
+  std::int32_t value = 0;
+  std::uint32_t changes = 0;
+  std::uint32_t changed_time = 0;
+};
+
+/**
+ * V5 controller.  Buttons are a bitmask indexed by controller_digital_e_t - DIGITAL_L1.
+ */
+struct Controller {
+  std::int32_t analog[4] = {};
+  std::uint32_t buttons = 0;
+  std::uint32_t new_press_seen = 0;
+};
+
+/**
+ * Everything the robot can talk to.
+ */
+struct Devices {
+  Motor motors[22];
+  Imu imus[22];
+  AdiOut adi[8];
+  Controller controllers[2];
+  std::uint8_t competition = 1;  // COMPETITION_DISABLED
+  double battery_mv = 12800;
+  std::uint32_t now = 0;
+};
+
+Devices& devices();
+
+/**
+ * Something that moves motors and sensors, ie. a drivetrain.  Motors a plant doesn't
+ * own spin freely with a first order response.
+ */
+class Plant {
+ public:
+  virtual ~Plant() = default;
+
+  /**
+   * Advances the plant by dt seconds.
+   */
+  virtual void step(double dt) = 0;
+};
+
+/**
+ * Adds a plant.  Plants step in the order they were added.
+ */
+void plant_add(Plant* plant);
+
+/**
+ * Starts stepping devices and plants every 1 ms of virtual time.
+ */
+void devices_start();
+
+/**
+ * Returns the port index for a pros port number, or -1 if it's out of range.
+ */
+int port_index(int port);
+
+/**
+ * Charges DEVICE_CALL_US of virtual time for one device call.
+ */
+void device_call();
+
+}  // namespace sim
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace sim {
+
+/**
+ * Thrown inside a task that was removed so its stack unwinds.
+ */
+struct TaskRemoved {};
+
+/**
+ * One simulated PROS task.  Every task is a host thread, but only the task that
+ * holds the baton runs.
+ */
+struct TaskControl {
+  std::string name;
+  std::uint32_t prio = 8;
+  std::uint64_t wake = 0;
+  std::uint64_t seq = 0;
+  std::uint32_t notify_value = 0;
+  bool waiting_notify = false;
+  bool suspended = false;
+  bool removed = false;
+  bool done = false;
+  std::condition_variable cv;
+};
+
+/**
+ * Virtual time RTOS.  Tasks run one at a time and only switch when they delay, so a
+ * run is deterministic and time only moves as fast as the host can step the world.
+ */
+class Kernel {
+ public:
+  /**
+   * Returns the kernel.  The first thread that calls this becomes the "main" task.
+   */
+  static Kernel& get();
+
+  /**
+   * Virtual time since start.
+   */
+  std::uint64_t micros();
+  std::uint32_t millis();
+
+  /**
+   * Blocks the current task for ms and runs whatever is due in the meantime.
+   */
+  void delay(std::uint32_t ms);
+
+  /**
+   * Blocks the current task until *prev_time + delta, then moves *prev_time forward by delta.
+   */
+  void delay_until(std::uint32_t* prev_time, std::uint32_t delta);
+
+  /**
+   * Moves the clock forward without switching tasks.  Devices use this to charge the
+   * time a call takes on the brain.
+   */
+  void charge(std::uint32_t us);
+
+  /**
+   * Creates a task.  It first runs the next time the current task blocks.
+   */
+  TaskControl* create(void (*function)(void*), void* parameters, std::uint32_t prio, const char* name);
+
+  /**
+   * Removes a task.  nullptr removes the current task.
+   */
+  void remove(TaskControl* task);
+
+  void suspend(TaskControl* task);
+  void resume(TaskControl* task);
+
+  /**
+   * Direct to task notifications.
+   */
+  std::uint32_t notify(TaskControl* task);
+  std::uint32_t notify_take(bool clear_on_exit, std::uint32_t timeout);
+
+  /**
+   * Returns the running task.
+   */
+  TaskControl* current();
+
+  /**
+   * Returns the number of tasks that haven't finished.
+   */
+  std::uint32_t count();
+
+  /**
+   * Registers a function that is called every 1 ms of virtual time, before any task
+   * that wakes at that time runs.  This is where devices and physics update.
+   */
+  void on_tick(std::function<void(std::uint32_t now_ms)> callback);
+
+  /**
+   * Registers a function that is called every time a task calls delay(), before it blocks.
+   * It runs with the kernel locked, so it must not call back into the kernel.
+   */
+  void on_delay(std::function<void(TaskControl* task, std::uint32_t ms)> callback);
+
+  /**
+   * Time spent on the host, for reporting how much faster than real time a run was.
+   */
+  double host_seconds();
+
+ private:
+  Kernel();
+  void advance(std::uint64_t to);
+  void block(std::unique_lock<std::mutex>& lock, TaskControl* self);
+  void switch_next(std::unique_lock<std::mutex>& lock);
+  void wait_turn(std::unique_lock<std::mutex>& lock, TaskControl* self);
+
+  std::mutex mutex;
+  std::vector<TaskControl*> tasks;
+  std::vector<std::function<void(std::uint32_t)>> tick_callbacks;
+  std::vector<std::function<void(TaskControl*, std::uint32_t)>> delay_callbacks;
+  TaskControl* running = nullptr;
+  std::uint64_t now = 0;
+  std::uint32_t last_tick = 0;
+  std::uint64_t next_seq = 0;
+  double host_start = 0;
+};
+
+}  // namespace sim
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <vector>
+
+#include "drive_model.hpp"
+#include "sim/devices.hpp"
+
+namespace sim {
+
+/**
+ * Drivetrain plant.  Feeds the motor voltages into a DriveModel and writes the motor
+ * positions, velocities and currents, the IMUs and the battery back from it.  Every IMU
+ * is on the chassis, so they all see its rotation.
+ */
+class TankPlant : public Plant {
+ public:
+  /**
+   * Ports use the ez::Drive convention, negative ports are motors mounted backwards.
+   */
+  TankPlant(std::vector<int> left_ports, std::vector<int> right_ports, DriveModel::Params params = DriveModel::Params());
+
+  void step(double dt) override;
+
+  DriveModel model;
+
+ private:
+  struct Side {
+    std::vector<int> ports;
+    double volts = 0;
+    bool coast = false;
+  };
+  void side_read(Side& side);
+  void side_write(Side& side, double wheel_velocity, double current, double dt);
+
+  Side left;
+  Side right;
+};
+
+}  // namespace sim
@@ -0,0 +1,83 @@
+// 3 wire ports and rotation sensors on the simulated devices
+
+#include <cctype>
+#include <cstddef>
+
+#include "pros/adi.hpp"
+#include "pros/error.h"
+#include "pros/rotation.hpp"
+#include "sim/devices.hpp"
+
+using sim::device_call;
+using sim::devices;
+
+// 'A'-'H', 'a'-'h' or 1-8 -> 0-7
+static int adi_index(std::uint8_t port) {
+  if (port >= 'a' && port <= 'h') return port - 'a';
+  if (port >= 'A' && port <= 'H') return port - 'A';
+  if (port >= 1 && port <= 8) return port - 1;
+  return -1;
+}
+
+namespace pros {
+
+ADIPort::ADIPort(std::uint8_t adi_port, adi_port_config_e_t type) : _smart_port(INTERNAL_ADI_PORT), _adi_port(adi_port) { set_config(type); }
+
+ADIPort::ADIPort(ext_adi_port_pair_t port_pair, adi_port_config_e_t type) : _smart_port(port_pair.first), _adi_port(port_pair.second) { set_config(type); }
+
+std::int32_t ADIPort::get_config() const { return E_ADI_TYPE_UNDEFINED; }
+
+std::int32_t ADIPort::set_config(adi_port_config_e_t) const { return 1; }
+
+std::int32_t ADIPort::get_value() const {
+  int i = adi_index(_adi_port);
+  if (i < 0) return PROS_ERR;
+  device_call();
+  return devices().adi[i].value;
+}
+
+std::int32_t ADIPort::set_value(std::int32_t value) const {
+  int i = adi_index(_adi_port);
+  if (i < 0) return PROS_ERR;
+  device_call();
+  sim::AdiOut& out = devices().adi[i];
+  if (out.value != value) {
+    out.value = value;
+    out.changes++;
+    out.changed_time = devices().now;
+  }
+  return 1;
+}
+
+ADIDigitalOut::ADIDigitalOut(std::uint8_t adi_port, bool init_state) : ADIPort(adi_port, E_ADI_DIGITAL_OUT) { set_value(init_state); }
+
+ADIDigitalOut::ADIDigitalOut(ext_adi_port_pair_t port_pair, bool init_state) : ADIPort(port_pair, E_ADI_DIGITAL_OUT) { set_value(init_state); }
+
+ADIDigitalIn::ADIDigitalIn(std::uint8_t adi_port) : ADIPort(adi_port, E_ADI_DIGITAL_IN) {}
+
+ADIDigitalIn::ADIDigitalIn(ext_adi_port_pair_t port_pair) : ADIPort(port_pair, E_ADI_DIGITAL_IN) {}
+
+std::int32_t ADIDigitalIn::get_new_press() const { return 0; }
+
+ADIEncoder::ADIEncoder(std::uint8_t adi_port_top, std::uint8_t, bool) : ADIPort(adi_port_top, E_ADI_LEGACY_ENCODER) {}
+
+ADIEncoder::ADIEncoder(ext_adi_port_tuple_t port_tuple, bool) : ADIPort(std::get<1>(port_tuple), E_ADI_LEGACY_ENCODER) {}
+
+std::int32_t ADIEncoder::reset() const { return 1; }
+
+std::int32_t ADIEncoder::get_value() const { return 0; }
+
+// This robot has no rotation sensors, Drive only constructs unused ones
+Rotation::Rotation(const std::uint8_t port, const bool) : _port(port) {}
+std::int32_t Rotation::reset() { return 1; }
+std::int32_t Rotation::set_data_rate(std::uint32_t) const { return 1; }
+std::int32_t Rotation::set_position(std::uint32_t) { return 1; }
+std::int32_t Rotation::reset_position(void) { return 1; }
+std::int32_t Rotation::get_position() { return 0; }
+std::int32_t Rotation::get_velocity() { return 0; }
+std::int32_t Rotation::get_angle() { return 0; }
+std::int32_t Rotation::set_reversed(bool) { return 1; }
+std::int32_t Rotation::reverse() { return 1; }
+std::int32_t Rotation::get_reversed() { return 0; }
+
+}  // namespace pros
@@ -0,0 +1,204 @@
+// Auton benchmark.  Runs every competition routine in autons.cpp back to back on the virtual
+// clock and shows where each one spends its 15 seconds:
+//
+//   bench [--time <ms>]
+//
+// Every pid_drive_set / pid_turn_set / pid_swing_set is a segment, timed until the pid_wait
+// that ends it (or the next motion, if it was chained without one) along with the exits that
+// ended the wait.  Delays are the pros::delay time of the auton task outside of pid_wait,
+// split by whether the drive was idle or still running a motion.  --time caps each routine,
+// it defaults past 15 s so an overrun shows how far over it went.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "main.h"
+#include "motion_trace.hpp"
+#include "sim/competition.hpp"
+#include "sim/devices.hpp"
+#include "sim/kernel.hpp"
+
+namespace {
+constexpr std::uint32_t AUTON_TIME = 15000;
+
+struct Routine {
+  const char* name;
+  void (*function)();
+};
+
+const Routine ROUTINES[] = {
+    {"david", david},
+    {"riskyOf", riskyOf},
+    {"sixBall", sixBall},
+    {"elimsDef", elimsDef},
+    {"riskyDef", riskyDef},
+    {"safeSafe", safeSafe},
+    {"midSafe", midSafe},
+};
+
+struct Segment {
+  ez::e_mode mode;
+  double target;
+  std::uint32_t start;
+  std::uint32_t end = 0;
+  std::uint32_t wait = 0;  // part of start..end spent in pid_wait
+  bool waited = false;
+  ez::exit_output exits[2] = {ez::RUNNING, ez::RUNNING};
+};
+
+struct Report {
+  std::vector<Segment> segments;
+  std::uint32_t start = 0;
+  std::uint32_t end = 0;
+  std::uint32_t delay_idle = 0;
+  std::uint32_t delay_moving = 0;
+  bool finished = false;
+};
+
+// What the trace callbacks are filling in.  Only the auton task's delays are counted
+Report* report = nullptr;
+sim::TaskControl* auton_task = nullptr;
+bool in_motion = false;
+bool in_wait = false;
+std::uint32_t wait_start = 0;
+
+void segment_close(std::uint32_t now) {
+  if (!in_motion) return;
+  report->segments.back().end = now;
+  in_motion = false;
+}
+
+void motion_start(ez::e_mode mode, double target) {
+  std::uint32_t now = pros::millis();
+  segment_close(now);
+  Segment segment;
+  segment.mode = mode;
+  segment.target = target;
+  segment.start = now;
+  report->segments.push_back(segment);
+  in_motion = true;
+}
+
+void wait_begin() {
+  in_wait = true;
+  wait_start = pros::millis();
+}
+
+void wait_end(ez::exit_output first, ez::exit_output second) {
+  std::uint32_t now = pros::millis();
+  in_wait = false;
+  if (!in_motion) return;
+  Segment& segment = report->segments.back();
+  segment.wait += now - wait_start;
+  segment.waited = true;
+  segment.exits[0] = first;
+  segment.exits[1] = second;
+  segment_close(now);
+}
+
+// Runs with the kernel locked, so only reads what the auton task wrote before it blocked
+void delay_count(sim::TaskControl* task, std::uint32_t ms) {
+  if (!report || task != auton_task || in_wait) return;
+  (in_motion ? report->delay_moving : report->delay_idle) += ms;
+}
+
+const char* mode_name(ez::e_mode mode) {
+  switch (mode) {
+    case ez::DRIVE:
+      return "drive";
+    case ez::TURN:
+      return "turn";
+    case ez::SWING:
+      return "swing";
+    default:
+      return "none";
+  }
+}
+
+std::string exits_name(const Segment& segment) {
+  if (!segment.waited) return segment.end ? "chained" : "cut off";
+  if (segment.mode != ez::DRIVE || segment.exits[0] == segment.exits[1]) return ez::exit_to_string(segment.exits[0]);
+  return ez::exit_to_string(segment.exits[0]) + " / " + ez::exit_to_string(segment.exits[1]);
+}
+
+void report_print(const Routine& routine, const Report& r) {
+  std::uint32_t total = r.end - r.start;
+  std::uint32_t motions = 0;
+  std::printf("\n%s\n", routine.name);
+  std::printf("   #  motion  target     start   time   wait  exit\n");
+  for (std::size_t i = 0; i < r.segments.size(); i++) {
+    const Segment& s = r.segments[i];
+    std::uint32_t end = s.end ? s.end : r.end;
+    motions += end - s.start;
+    std::printf("  %2zu  %-6s %7.1f %s %6lu %6lu %6lu  %s\n", i + 1, mode_name(s.mode), s.target, s.mode == ez::DRIVE ? "in " : "deg",
+                (unsigned long)(s.start - r.start), (unsigned long)(end - s.start), (unsigned long)s.wait, exits_name(s).c_str());
+  }
+  std::printf("  motions %lu ms, delays %lu ms idle + %lu ms during motions, total %lu ms", (unsigned long)motions,
+              (unsigned long)r.delay_idle, (unsigned long)r.delay_moving, (unsigned long)total);
+  if (!r.finished)
+    std::printf(" (cut off)\n");
+  else if (total > AUTON_TIME)
+    std::printf(" (%lu ms over)\n", (unsigned long)(total - AUTON_TIME));
+  else
+    std::printf(" (%lu ms to spare)\n", (unsigned long)(AUTON_TIME - total));
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::uint32_t time = 20000;
+  for (int i = 1; i < argc; i++) {
+    if (!std::strcmp(argv[i], "--time") && i + 1 < argc) {
+      time = std::strtoul(argv[++i], nullptr, 10);
+    } else {
+      std::printf("usage: %s [--time <ms>]\n", argv[0]);
+      std::exit(2);
+    }
+  }
+
+  sim::TankPlant& drive = sim::chassis_plant_add();
+  sim::devices_start();
+  sim::devices().competition = COMPETITION_DISABLED | COMPETITION_CONNECTED;
+  initialize();
+  startup.wait();  // On the field the robot boots long before autonomous
+  chassis.pid_print_toggle(false);
+
+  // Every routine gets its own selector page, so autonomous() runs exactly as it does on the robot
+  std::vector<Auton> autons;
+  for (const Routine& routine : ROUTINES) autons.push_back(Auton(routine.name, routine.function));
+  ez::as::auton_selector.autons_add(autons);
+
+  motion_trace.motion_start = motion_start;
+  motion_trace.wait_begin = wait_begin;
+  motion_trace.wait_end = wait_end;
+  sim::Kernel::get().on_delay(delay_count);
+
+  std::vector<Report> reports(std::size(ROUTINES));
+  for (std::size_t i = 0; i < reports.size(); i++) {
+    // Put the robot back at the start, and give every motor and the IMU time to report it
+    drive.model.reset();
+    pros::delay(500);
+    ez::as::auton_selector.auton_page_current = i;
+
+    report = &reports[i];
+    in_motion = in_wait = false;
+    report->start = pros::millis();
+    report->finished = sim::period_run(autonomous, "User Autonomous (PROS)", COMPETITION_AUTONOMOUS | COMPETITION_CONNECTED, time,
+                                       [](pros::task_t task) { auton_task = static_cast<sim::TaskControl*>(task); });
+    report->end = pros::millis();
+    in_motion = false;
+    auton_task = nullptr;
+    report = nullptr;
+  }
+
+  for (std::size_t i = 0; i < reports.size(); i++) report_print(ROUTINES[i], reports[i]);
+
+  double host = sim::Kernel::get().host_seconds();
+  std::printf("\nbench: %lu ms simulated in %.2f s on the host (%.0fx real time)\n", (unsigned long)pros::millis(), host,
+              host > 0 ? pros::millis() / 1000.0 / host : 0.0);
+  std::fflush(stdout);
+
+  // Every other task is parked on the kernel, so don't wait for them to unwind
+  std::_Exit(0);
+}
@@ -0,0 +1,40 @@
+#include "sim/competition.hpp"
+
+#include "main.h"
+
+namespace sim {
+
+// Ports in the ez::Drive convention, negative for reversed motors
+static std::vector<int> ports_get(std::vector<pros::Motor>& motors) {
+  std::vector<int> ports;
+  for (auto& motor : motors) ports.push_back(motor.is_reversed() ? -motor.get_port() : motor.get_port());
+  return ports;
+}
+
+TankPlant& chassis_plant_add() {
+  static TankPlant* plant = new TankPlant(ports_get(chassis.left_motors), ports_get(chassis.right_motors));
+  plant_add(plant);
+  return *plant;
+}
+
+bool period_run(void (*period)(), const char* name, std::uint8_t status, std::uint32_t time, std::function<void(pros::task_t)> started) {
+  devices().competition = status;
+  pros::Task task(period, name);
+  if (started) started(static_cast<pros::task_t>(task));
+
+  bool finished = true;
+  std::uint32_t end = pros::millis() + time;
+  while (task.get_state() != pros::E_TASK_STATE_DELETED) {
+    if (pros::millis() >= end) {
+      task.remove();
+      finished = false;
+      break;
+    }
+    pros::delay(1);
+  }
+
+  devices().competition = COMPETITION_DISABLED | COMPETITION_CONNECTED;
+  return finished;
+}
+
+}  // namespace sim
@@ -0,0 +1,134 @@
+#include "sim/devices.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "pros/misc.h"
+#include "sim/kernel.hpp"
+
+namespace sim {
+
+static std::vector<Plant*> plants;
+
+Devices& devices() {
+  static Devices* d = new Devices();
+  return *d;
+}
+
+double Motor::free_rpm() const { return gearset == 0 ? 100 : gearset == 2 ? 600 : 200; }
+
+double Motor::counts_per_rev() const { return gearset == 0 ? 1800 : gearset == 2 ? 300 : 900; }
+
+double Motor::volts() const { return voltage / 1000.0; }
+
+void plant_add(Plant* plant) { plants.push_back(plant); }
+
+int port_index(int port) {
+  port = std::abs(port);
+  return port >= 1 && port <= 21 ? port : -1;
+}
+
+void device_call() { Kernel::get().charge(DEVICE_CALL_US); }
+
+// Motor that isn't attached to anything, the shaft follows the voltage with a short lag
+static void free_motor_step(Motor& m, double dt) {
+  constexpr double TAU = 0.04;
+  double target = m.volts() / 12.0 * m.free_rpm();
+  double tau = TAU;
+  if (m.voltage == 0 && m.brake_mode != 0) tau = TAU / 4.0;
+  m.velocity += (target - m.velocity) * std::min(1.0, dt / tau);
+  m.position += m.velocity / 60.0 * 360.0 * dt;
+  double amps = 2.5 * (m.volts() / 12.0 - m.velocity / m.free_rpm());
+  m.current = std::min(std::fabs(amps) * 1000.0, (double)m.current_limit);
+}
+
+// Windings heat with I^2 and cool toward the room.  Close to a V5 motor, but not the same
+// numbers as ThermalMonitor's defaults so the sim doesn't flatter it
+static void motor_heat_step(Motor& m, double dt) {
+  constexpr double AMBIENT = 25;
+  constexpr double HEATING = 0.07;  // C per A^2 per second
+  constexpr double TIME_CONSTANT = 300;
+  double amps = m.current / 1000.0;
+  m.temperature += dt * (HEATING * amps * amps - (m.temperature - AMBIENT) / TIME_CONSTANT);
+}
+
+// Gaussian with a standard deviation of 1, the same sequence every run so results repeat
+static double noise_sample() {
+  static std::uint32_t state = 0x9e3779b9;
+  double sum = 0;
+  for (int i = 0; i < 12; i++) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    sum += state / 4294967296.0;
+  }
+  return sum - 6.0;
+}
+
+// The motor's internal velocity / position loop
+static void motor_controller_step(Motor& m) {
+  double target = m.target_velocity;
+  if (m.mode == Motor::POSITION) {
+    double limit = std::fabs(m.target_velocity);
+    target = std::clamp((m.target_position - m.position) * 2.0, -limit, limit);
+  }
+  double out = target / m.free_rpm() * 12000.0 + (target - m.velocity) * 40.0;
+  m.voltage = std::clamp(out, -12000.0, 12000.0);
+}
+
+static void tick(std::uint32_t now) {
+  Devices& d = devices();
+  d.now = now;
+  constexpr double DT = 0.001;
+
+  // A disabled brain drops every motor command, so the next period starts from a stopped robot
+  bool disabled = d.competition & COMPETITION_DISABLED;
+  for (int port = 1; port <= 21; port++) {
+    Motor& m = d.motors[port];
+    if (disabled) {
+      m.voltage = 0;
+      m.mode = Motor::VOLTAGE;
+      m.pending = false;
+    } else if (m.pending && now >= m.pending_time) {
+      m.voltage = m.pending_voltage;
+      m.pending = false;
+    }
+  }
+
+  for (int port = 1; port <= 21; port++) {
+    Motor& m = d.motors[port];
+    if (m.used && m.mode != Motor::VOLTAGE) motor_controller_step(m);
+  }
+
+  for (auto plant : plants) plant->step(DT);
+
+  for (int port = 1; port <= 21; port++) {
+    Motor& m = d.motors[port];
+    if (!m.used) continue;
+    if (!m.driven) free_motor_step(m, DT);
+    motor_heat_step(m, DT);
+
+    // Each port reports on its own phase, like the real smart port bus
+    if ((now + port) % MOTOR_UPDATE_MS == 0) {
+      m.reported_position = m.position;
+      m.reported_velocity = m.velocity;
+      m.reported_current = m.current;
+      m.reported_temperature = std::round(m.temperature / 5.0) * 5.0;  // V5 motors report in 5C steps
+      m.reported_time = now;
+    }
+  }
+
+  for (int port = 1; port <= 21; port++) {
+    Imu& imu = d.imus[port];
+    if (!imu.used || now < imu.calibrate_until) continue;
+    if ((now + port) % IMU_UPDATE_MS == 0) {
+      imu.reported_rotation = imu.rotation + (imu.noise > 0 ? imu.noise * noise_sample() : 0.0);
+      imu.reported_rate = imu.rate;
+      imu.reported_time = now;
+    }
+  }
+}
+
+void devices_start() { Kernel::get().on_tick(tick); }
+
+}  // namespace sim
@@ -0,0 +1,116 @@
+// Checks the serial telemetry framing on the host, the same code tlm_decode and the robot use:
+//
+//   frame_check
+//
+// crc16() against the published CRC-16/CCITT-FALSE vectors, COBS against hand encoded vectors
+// and round trips full of zeros, and a frame that's corrupted or cut short failing to decode.
+// Exits non zero if a check fails.
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "crc16.hpp"
+#include "telemetry_frame.hpp"
+
+namespace {
+int failures = 0;
+
+void check(bool ok, const char* what, unsigned long got, unsigned long expected) {
+  std::printf("%s %s (got %lu, expected %lu)\n", ok ? "pass" : "FAIL", what, got, expected);
+  if (!ok) failures++;
+}
+
+void check_equal(const char* what, unsigned long got, unsigned long expected) { check(got == expected, what, got, expected); }
+
+const std::uint8_t* bytes(const char* text) { return (const std::uint8_t*)text; }
+
+void crc_check() {
+  check_equal("crc of 123456789", crc16(bytes("123456789"), 9), 0x29b1);
+  check_equal("crc of nothing is the init", crc16(bytes(""), 0), 0xffff);
+  check_equal("crc of A", crc16(bytes("A"), 1), 0xb915);
+  // Passing the last result on is the same as one call over all of it
+  check_equal("crc continued over two calls", crc16(bytes("6789"), 4, crc16(bytes("12345"), 5)), 0x29b1);
+}
+
+// Encodes input, checks it against the expected encoding, and decodes it back
+void cobs_vector_check(std::string what, std::vector<std::uint8_t> input, std::vector<std::uint8_t> expected) {
+  std::vector<std::uint8_t> encoded(input.size() + input.size() / 254 + 1);
+  std::size_t size = cobs_encode(input.data(), input.size(), encoded.data());
+  encoded.resize(size);
+  check(encoded == expected, (what + " encodes").c_str(), size, expected.size());
+
+  std::vector<std::uint8_t> decoded(size);
+  std::size_t decoded_size = cobs_decode(encoded.data(), size, decoded.data());
+  decoded.resize(decoded_size);
+  check(decoded == input, (what + " decodes").c_str(), decoded_size, input.size());
+}
+
+void cobs_check() {
+  cobs_vector_check("cobs of one zero", {0x00}, {0x01, 0x01});
+  cobs_vector_check("cobs of two zeros", {0x00, 0x00}, {0x01, 0x01, 0x01});
+  cobs_vector_check("cobs with a zero inside", {0x11, 0x22, 0x00, 0x33}, {0x03, 0x11, 0x22, 0x02, 0x33});
+  cobs_vector_check("cobs without zeros", {0x11, 0x22, 0x33, 0x44}, {0x05, 0x11, 0x22, 0x33, 0x44});
+  cobs_vector_check("cobs with trailing zeros", {0x11, 0x00, 0x00, 0x00}, {0x02, 0x11, 0x01, 0x01, 0x01});
+
+  // Every size up to past two full 254 byte blocks, with a zero every few bytes and long runs
+  // without one, has to come back the same and never encode a zero
+  unsigned long bad = 0;
+  std::uint32_t seed = 1;
+  for (std::size_t size = 0; size < 600; size++) {
+    std::vector<std::uint8_t> input(size);
+    for (auto& byte : input) {
+      seed = seed * 1103515245 + 12345;
+      byte = size % 3 == 0 ? (seed >> 16) % 255 + 1 : (seed >> 16) % 4 == 0 ? 0 : seed >> 24;
+    }
+    std::vector<std::uint8_t> encoded(size + size / 254 + 1);
+    std::size_t encoded_size = cobs_encode(input.data(), size, encoded.data());
+    std::vector<std::uint8_t> decoded(encoded_size);
+    std::size_t decoded_size = cobs_decode(encoded.data(), encoded_size, decoded.data());
+    decoded.resize(decoded_size);
+    if (encoded_size > encoded.size() || std::memchr(encoded.data(), 0, encoded_size) || decoded != input) bad++;
+  }
+  check_equal("cobs round trips that didn't", bad, 0);
+
+  std::uint8_t output[8];
+  const std::uint8_t overrun[] = {0x05, 0x11, 0x22};
+  check_equal("cobs block longer than the input", cobs_decode(overrun, sizeof(overrun), output), 0);
+  const std::uint8_t zero[] = {0x03, 0x11, 0x00};
+  check_equal("cobs with a zero in it", cobs_decode(zero, sizeof(zero), output), 0);
+}
+
+void frame_check() {
+  // Zeros in the time, mode and values, so the COBS has something to do
+  Telemetry::Record record = {};
+  record.time = 0x00120000;
+  record.source = Telemetry::INPUTS;
+  record.seq = 256;
+  record.values[0] = 1024;
+  record.values[1] = -127;
+
+  std::uint8_t frame[TELEMETRY_FRAME_ENCODED_MAX];
+  std::size_t size = telemetry_frame_encode(record, frame);
+  check(size <= TELEMETRY_FRAME_ENCODED_MAX, "frame fits in TELEMETRY_FRAME_ENCODED_MAX", size, TELEMETRY_FRAME_ENCODED_MAX);
+  check_equal("frame ends in its delimiter", frame[size - 1], 0);
+  check_equal("frame has no other zeros", std::memchr(frame, 0, size - 1) == nullptr, 1);
+
+  Telemetry::Record decoded;
+  check_equal("frame decodes", telemetry_frame_decode(frame, size - 1, decoded), 1);
+  check_equal("frame decodes to the record", std::memcmp(&decoded, &record, sizeof(record)) == 0, 1);
+
+  check_equal("frame cut short fails", telemetry_frame_decode(frame, size - 2, decoded), 0);
+  std::uint8_t corrupt[TELEMETRY_FRAME_ENCODED_MAX];
+  std::memcpy(corrupt, frame, size);
+  corrupt[size / 2] ^= corrupt[size / 2] == 0x01 ? 0x03 : 0x01;
+  check_equal("frame with a flipped bit fails", telemetry_frame_decode(corrupt, size - 1, decoded), 0);
+}
+}  // namespace
+
+int main() {
+  crc_check();
+  cobs_check();
+  frame_check();
+  std::printf("%s\n", failures ? "frame_check: FAILED" : "frame_check: all passed");
+  return failures ? 1 : 0;
+}
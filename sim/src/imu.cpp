@@ -0,0 +1,125 @@
+// V5 inertial sensor on the simulated devices
+
+#include <cerrno>
+#include <cmath>
+
+#include "pros/error.h"
+#include "pros/imu.hpp"
+#include "pros/rtos.h"
+#include "sim/devices.hpp"
+
+using sim::device_call;
+using sim::devices;
+
+static sim::Imu* imu_get(uint8_t port) {
+  int i = sim::port_index(port);
+  if (i < 0) {
+    errno = ENXIO;
+    return nullptr;
+  }
+  sim::Imu& imu = devices().imus[i];
+  imu.used = true;
+  device_call();
+  if (devices().now < imu.calibrate_until) {
+    errno = EAGAIN;
+    return nullptr;
+  }
+  return &imu;
+}
+
+static double wrap_heading(double rotation) {
+  double heading = std::fmod(rotation, 360.0);
+  return heading < 0 ? heading + 360.0 : heading;
+}
+
+static double wrap_yaw(double rotation) {
+  double yaw = wrap_heading(rotation);
+  return yaw > 180.0 ? yaw - 360.0 : yaw;
+}
+
+namespace pros {
+namespace c {
+
+int32_t imu_reset(uint8_t port) {
+  int i = sim::port_index(port);
+  if (i < 0) return PROS_ERR;
+  sim::Imu& imu = devices().imus[i];
+  imu.used = true;
+  imu.calibrate_until = devices().now + sim::IMU_CALIBRATION_MS;
+  imu.offset = -imu.rotation;
+  return 1;
+}
+
+double imu_get_rotation(uint8_t port) {
+  sim::Imu* imu = imu_get(port);
+  return imu ? imu->reported_rotation + imu->offset : PROS_ERR_F;
+}
+
+double imu_get_heading(uint8_t port) {
+  sim::Imu* imu = imu_get(port);
+  return imu ? wrap_heading(imu->reported_rotation + imu->offset) : PROS_ERR_F;
+}
+
+imu_gyro_s_t imu_get_gyro_rate(uint8_t port) {
+  sim::Imu* imu = imu_get(port);
+  if (!imu) return {PROS_ERR_F, PROS_ERR_F, PROS_ERR_F};
+  return {0, 0, imu->reported_rate};
+}
+
+int32_t imu_set_rotation(uint8_t port, double target) {
+  sim::Imu* imu = imu_get(port);
+  if (!imu) return PROS_ERR;
+  imu->offset = target - imu->reported_rotation;
+  return 1;
+}
+
+imu_status_e_t imu_get_status(uint8_t port) {
+  int i = sim::port_index(port);
+  if (i < 0) return E_IMU_STATUS_ERROR;
+  device_call();
+  return devices().now < devices().imus[i].calibrate_until ? E_IMU_STATUS_CALIBRATING : E_IMU_STATUS_READY;
+}
+
+}  // namespace c
+
+using namespace pros::c;
+
+std::int32_t Imu::reset(bool blocking) const {
+  std::int32_t out = imu_reset(_port);
+  if (blocking) {
+    while (is_calibrating()) pros::c::delay(10);
+  }
+  return out;
+}
+
+std::int32_t Imu::set_data_rate(std::uint32_t) const { return 1; }
+double Imu::get_rotation() const { return imu_get_rotation(_port); }
+double Imu::get_heading() const { return imu_get_heading(_port); }
+quaternion_s_t Imu::get_quaternion() const {
+  double yaw = get_yaw() * M_PI / 180.0;
+  return {0, 0, std::sin(-yaw / 2), std::cos(-yaw / 2)};
+}
+euler_s_t Imu::get_euler() const { return {0, 0, get_yaw()}; }
+double Imu::get_pitch() const { return 0; }
+double Imu::get_roll() const { return 0; }
+double Imu::get_yaw() const { return wrap_yaw(get_rotation()); }
+imu_gyro_s_t Imu::get_gyro_rate() const { return imu_get_gyro_rate(_port); }
+std::int32_t Imu::tare_rotation() const { return set_rotation(0); }
+std::int32_t Imu::tare_heading() const { return set_heading(0); }
+std::int32_t Imu::tare_pitch() const { return 1; }
+std::int32_t Imu::tare_yaw() const { return set_yaw(0); }
+std::int32_t Imu::tare_roll() const { return 1; }
+std::int32_t Imu::tare() const { return tare_rotation(); }
+std::int32_t Imu::tare_euler() const { return tare_yaw(); }
+std::int32_t Imu::set_heading(const double target) const { return imu_set_rotation(_port, get_rotation() - get_heading() + target); }
+std::int32_t Imu::set_rotation(const double target) const { return imu_set_rotation(_port, target); }
+std::int32_t Imu::set_yaw(const double target) const { return imu_set_rotation(_port, get_rotation() - get_yaw() + target); }
+std::int32_t Imu::set_pitch(const double) const { return 1; }
+std::int32_t Imu::set_roll(const double) const { return 1; }
+std::int32_t Imu::set_euler(const euler_s_t target) const { return set_yaw(target.yaw); }
+imu_accel_s_t Imu::get_accel() const { return {0, 0, 1}; }
+imu_status_e_t Imu::get_status() const { return imu_get_status(_port); }
+bool Imu::is_calibrating() const { return get_status() == E_IMU_STATUS_CALIBRATING; }
+imu_orientation_e_t Imu::get_physical_orientation() const { return E_IMU_Z_UP; }
+
+}  // namespace pros
@@ -0,0 +1,209 @@
+#include "sim/kernel.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <thread>
+
+namespace sim {
+
+static constexpr std::uint64_t NEVER = std::numeric_limits<std::uint64_t>::max();
+
+static double host_now() {
+  using namespace std::chrono;
+  return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+Kernel& Kernel::get() {
+  // Never destroyed, task threads can still be parked on it when the program exits
+  static Kernel* kernel = new Kernel();
+  return *kernel;
+}
+
+Kernel::Kernel() {
+  TaskControl* main = new TaskControl();
+  main->name = "main";
+  tasks.push_back(main);
+  running = main;
+  host_start = host_now();
+}
+
+std::uint64_t Kernel::micros() {
+  std::lock_guard<std::mutex> lock(mutex);
+  return now;
+}
+
+std::uint32_t Kernel::millis() {
+  std::lock_guard<std::mutex> lock(mutex);
+  return now / 1000;
+}
+
+void Kernel::advance(std::uint64_t to) {
+  while (now < to) {
+    std::uint64_t next_tick = (now / 1000 + 1) * 1000;
+    if (next_tick > to) {
+      now = to;
+      break;
+    }
+    now = next_tick;
+    last_tick = now / 1000;
+    for (auto& callback : tick_callbacks) callback(last_tick);
+  }
+}
+
+void Kernel::wait_turn(std::unique_lock<std::mutex>& lock, TaskControl* self) {
+  self->cv.wait(lock, [&] { return running == self; });
+  if (self->removed) throw TaskRemoved();
+}
+
+void Kernel::switch_next(std::unique_lock<std::mutex>& lock) {
+  // Earliest wake time runs first.  Ties go to the higher priority, then to whoever blocked first
+  TaskControl* next = nullptr;
+  for (auto task : tasks) {
+    if (task->done || task->suspended || task->wake == NEVER) continue;
+    if (!next || task->wake < next->wake || (task->wake == next->wake && (task->prio > next->prio || (task->prio == next->prio && task->seq < next->seq)))) {
+      next = task;
+    }
+  }
+  if (!next) {
+    printf("sim: every task is blocked forever at %llu ms\n", (unsigned long long)(now / 1000));
+    fflush(stdout);
+    std::_Exit(1);
+  }
+  advance(next->wake);
+  running = next;
+  next->cv.notify_one();
+}
+
+void Kernel::block(std::unique_lock<std::mutex>& lock, TaskControl* self) {
+  self->seq = next_seq++;
+  switch_next(lock);
+  wait_turn(lock, self);
+}
+
+void Kernel::delay(std::uint32_t ms) {
+  std::unique_lock<std::mutex> lock(mutex);
+  TaskControl* self = running;
+  for (auto& callback : delay_callbacks) callback(self, ms);
+  self->wake = (now / 1000 + ms) * 1000;
+  block(lock, self);
+}
+
+void Kernel::delay_until(std::uint32_t* prev_time, std::uint32_t delta) {
+  std::unique_lock<std::mutex> lock(mutex);
+  TaskControl* self = running;
+  *prev_time += delta;
+  std::uint64_t wake = (std::uint64_t)*prev_time * 1000;
+  if (wake <= now) return;
+  self->wake = wake;
+  block(lock, self);
+}
+
+void Kernel::charge(std::uint32_t us) {
+  std::lock_guard<std::mutex> lock(mutex);
+  advance(now + us);
+}
+
+TaskControl* Kernel::create(void (*function)(void*), void* parameters, std::uint32_t prio, const char* name) {
+  std::unique_lock<std::mutex> lock(mutex);
+  TaskControl* task = new TaskControl();
+  task->name = name ? name : "";
+  task->prio = prio;
+  task->wake = now;
+  task->seq = next_seq++;
+  tasks.push_back(task);
+
+  std::thread([this, task, function, parameters] {
+    std::unique_lock<std::mutex> lock(mutex);
+    try {
+      wait_turn(lock, task);
+      lock.unlock();
+      function(parameters);
+      lock.lock();
+    } catch (TaskRemoved&) {
+      if (!lock.owns_lock()) lock.lock();
+    }
+    task->done = true;
+    switch_next(lock);
+  }).detach();
+
+  return task;
+}
+
+void Kernel::remove(TaskControl* task) {
+  std::unique_lock<std::mutex> lock(mutex);
+  if (!task || task == running) throw TaskRemoved();
+  if (task->done) return;
+  // Wake it right away so it can unwind its stack
+  task->removed = true;
+  task->suspended = false;
+  task->wake = now;
+}
+
+void Kernel::suspend(TaskControl* task) {
+  std::unique_lock<std::mutex> lock(mutex);
+  if (!task) task = running;
+  task->suspended = true;
+  if (task == running) block(lock, task);
+}
+
+void Kernel::resume(TaskControl* task) {
+  std::unique_lock<std::mutex> lock(mutex);
+  if (!task->suspended) return;
+  task->suspended = false;
+  if (task->wake < now) task->wake = now;
+}
+
+std::uint32_t Kernel::notify(TaskControl* task) {
+  std::unique_lock<std::mutex> lock(mutex);
+  task->notify_value++;
+  if (task->waiting_notify) {
+    task->waiting_notify = false;
+    task->wake = now;
+  }
+  return task->notify_value;
+}
+
+std::uint32_t Kernel::notify_take(bool clear_on_exit, std::uint32_t timeout) {
+  std::unique_lock<std::mutex> lock(mutex);
+  TaskControl* self = running;
+  if (self->notify_value == 0 && timeout != 0) {
+    self->waiting_notify = true;
+    self->wake = timeout == std::numeric_limits<std::uint32_t>::max() ? NEVER : now + (std::uint64_t)timeout * 1000;
+    block(lock, self);
+    self->waiting_notify = false;
+  }
+  std::uint32_t value = self->notify_value;
+  if (clear_on_exit)
+    self->notify_value = 0;
+  else if (self->notify_value > 0)
+    self->notify_value--;
+  return value;
+}
+
+TaskControl* Kernel::current() {
+  std::lock_guard<std::mutex> lock(mutex);
+  return running;
+}
+
+std::uint32_t Kernel::count() {
+  std::lock_guard<std::mutex> lock(mutex);
+  std::uint32_t alive = 0;
+  for (auto task : tasks) alive += !task->done;
+  return alive;
+}
+
+void Kernel::on_tick(std::function<void(std::uint32_t)> callback) {
+  std::lock_guard<std::mutex> lock(mutex);
+  tick_callbacks.push_back(callback);
+}
+
+void Kernel::on_delay(std::function<void(TaskControl*, std::uint32_t)> callback) {
+  std::lock_guard<std::mutex> lock(mutex);
+  delay_callbacks.push_back(callback);
+}
+
+double Kernel::host_seconds() { return host_now() - host_start; }
+
+}  // namespace sim
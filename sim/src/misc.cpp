@@ -0,0 +1,174 @@
+// Controller, competition, battery, SD card and LLEMU on the simulated devices
+
+#include <cerrno>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
+#include "pros/apix.h"
+#include "pros/error.h"
+#include "pros/llemu.hpp"
+#include "pros/misc.hpp"
+#include "sim/devices.hpp"
+
+using sim::device_call;
+using sim::devices;
+
+static sim::Controller* controller_get(pros::controller_id_e_t id) {
+  if (id != pros::E_CONTROLLER_MASTER && id != pros::E_CONTROLLER_PARTNER) {
+    errno = EINVAL;
+    return nullptr;
+  }
+  device_call();
+  return &devices().controllers[id];
+}
+
+static std::uint32_t button_bit(pros::controller_digital_e_t button) { return 1u << (button - pros::E_CONTROLLER_DIGITAL_L1); }
+
+// LLEMU, every line that changes is echoed to the terminal
+static bool lcd_active = false;
+static char lcd_lines[8][64];
+
+static bool lcd_line(std::int16_t line, const char* text) {
+  if (!lcd_active) {
+    errno = ENXIO;
+    return false;
+  }
+  if (line < 0 || line > 7) {
+    errno = EINVAL;
+    return false;
+  }
+  if (std::strncmp(lcd_lines[line], text, sizeof(lcd_lines[line]) - 1) != 0) {
+    std::snprintf(lcd_lines[line], sizeof(lcd_lines[line]), "%s", text);
+    std::printf("[lcd %d] %s\n", line, lcd_lines[line]);
+  }
+  return true;
+}
+
+namespace pros {
+namespace c {
+
+int32_t controller_is_connected(controller_id_e_t id) { return controller_get(id) ? 1 : PROS_ERR; }
+
+int32_t controller_get_analog(controller_id_e_t id, controller_analog_e_t channel) {
+  sim::Controller* c = controller_get(id);
+  return c ? c->analog[channel] : PROS_ERR;
+}
+
+int32_t controller_get_digital(controller_id_e_t id, controller_digital_e_t button) {
+  sim::Controller* c = controller_get(id);
+  return c ? (c->buttons & button_bit(button)) != 0 : PROS_ERR;
+}
+
+int32_t controller_get_digital_new_press(controller_id_e_t id, controller_digital_e_t button) {
+  sim::Controller* c = controller_get(id);
+  if (!c) return PROS_ERR;
+  std::uint32_t bit = button_bit(button);
+  bool pressed = c->buttons & bit;
+  bool seen = c->new_press_seen & bit;
+  if (pressed)
+    c->new_press_seen |= bit;
+  else
+    c->new_press_seen &= ~bit;
+  return pressed && !seen;
+}
+
+int32_t controller_rumble(controller_id_e_t id, const char* rumble_pattern) {
+  if (!controller_get(id)) return PROS_ERR;
+  std::printf("[controller %d] rumble \"%s\"\n", id, rumble_pattern);
+  return 1;
+}
+
+uint8_t competition_get_status(void) { return devices().competition; }
+
+int32_t battery_get_voltage(void) { return devices().battery_mv; }
+
+int32_t usd_is_installed(void) { return 0; }
+
+// There's no V5 serial driver here, streams are plain files
+int32_t serctl(const uint32_t, void* const) { return 0; }
+
+int32_t fdctl(int, const uint32_t, void* const) { return 0; }
+
+bool lcd_is_initialized(void) { return lcd_active; }
+
+bool lcd_initialize(void) {
+  lcd_active = true;
+  std::memset(lcd_lines, 0, sizeof(lcd_lines));
+  return true;
+}
+
+bool lcd_shutdown(void) {
+  lcd_active = false;
+  return true;
+}
+
+bool lcd_print(int16_t line, const char* fmt, ...) {
+  char text[64];
+  va_list args;
+  va_start(args, fmt);
+  std::vsnprintf(text, sizeof(text), fmt, args);
+  va_end(args);
+  return lcd_line(line, text);
+}
+
+bool lcd_set_text(int16_t line, const char* text) { return lcd_line(line, text); }
+
+bool lcd_clear_line(int16_t line) { return lcd_line(line, ""); }
+
+bool lcd_clear(void) {
+  for (int line = 0; line < 8; line++) lcd_line(line, "");
+  return lcd_active;
+}
+
+uint8_t lcd_read_buttons(void) { return 0; }
+
+}  // namespace c
+
+using namespace pros::c;
+
+Controller::Controller(controller_id_e_t id) : _id(id) {}
+std::int32_t Controller::is_connected(void) { return controller_is_connected(_id); }
+std::int32_t Controller::get_analog(controller_analog_e_t channel) { return controller_get_analog(_id, channel); }
+std::int32_t Controller::get_battery_capacity(void) { return 100; }
+std::int32_t Controller::get_battery_level(void) { return 100; }
+std::int32_t Controller::get_digital(controller_digital_e_t button) { return controller_get_digital(_id, button); }
+std::int32_t Controller::get_digital_new_press(controller_digital_e_t button) { return controller_get_digital_new_press(_id, button); }
+std::int32_t Controller::set_text(std::uint8_t, std::uint8_t, const char*) { return 1; }
+std::int32_t Controller::set_text(std::uint8_t, std::uint8_t, const std::string&) { return 1; }
+std::int32_t Controller::clear_line(std::uint8_t) { return 1; }
+std::int32_t Controller::rumble(const char* rumble_pattern) { return controller_rumble(_id, rumble_pattern); }
+std::int32_t Controller::clear(void) { return 1; }
+
+namespace battery {
+double get_capacity(void) { return 100; }
+int32_t get_current(void) { return 0; }
+double get_temperature(void) { return 25; }
+int32_t get_voltage(void) { return battery_get_voltage(); }
+}  // namespace battery
+
+namespace competition {
+std::uint8_t get_status(void) { return competition_get_status(); }
+std::uint8_t is_autonomous(void) { return (competition_get_status() & COMPETITION_AUTONOMOUS) != 0; }
+std::uint8_t is_connected(void) { return (competition_get_status() & COMPETITION_CONNECTED) != 0; }
+std::uint8_t is_disabled(void) { return (competition_get_status() & COMPETITION_DISABLED) != 0; }
+}  // namespace competition
+
+namespace usd {
+std::int32_t is_installed(void) { return usd_is_installed(); }
+}  // namespace usd
+
+namespace lcd {
+bool is_initialized(void) { return lcd_is_initialized(); }
+bool initialize(void) { return lcd_initialize(); }
+bool shutdown(void) { return lcd_shutdown(); }
+bool set_text(std::int16_t line, std::string text) { return lcd_set_text(line, text.c_str()); }
+bool clear(void) { return lcd_clear(); }
+bool clear_line(std::int16_t line) { return lcd_clear_line(line); }
+void register_btn0_cb(lcd_btn_cb_fn_t) {}
+void register_btn1_cb(lcd_btn_cb_fn_t) {}
+void register_btn2_cb(lcd_btn_cb_fn_t) {}
+std::uint8_t read_buttons(void) { return lcd_read_buttons(); }
+}  // namespace lcd
+
+}  // namespace pros
@@ -0,0 +1,412 @@
+// V5 smart motors on the simulated devices
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+
+#include "pros/error.h"
+#include "pros/motors.hpp"
+#include "sim/devices.hpp"
+#include "sim/kernel.hpp"
+
+using sim::device_call;
+using sim::devices;
+
+static sim::Motor* motor_get(uint8_t port) {
+  int i = sim::port_index(port);
+  if (i < 0) {
+    errno = ENXIO;
+    return nullptr;
+  }
+  sim::Motor& m = devices().motors[i];
+  m.used = true;
+  device_call();
+  return &m;
+}
+
+// Direction the user asked for -> direction the shaft spins
+static double sign(const sim::Motor& m) { return m.reversed ? -1.0 : 1.0; }
+
+static double to_units(const sim::Motor& m, double degrees) {
+  switch (m.encoder_units) {
+    case pros::E_MOTOR_ENCODER_ROTATIONS:
+      return degrees / 360.0;
+    case pros::E_MOTOR_ENCODER_COUNTS:
+      return degrees / 360.0 * m.counts_per_rev();
+    default:
+      return degrees;
+  }
+}
+
+static double from_units(const sim::Motor& m, double position) { return position / to_units(m, 1.0); }
+
+namespace pros {
+namespace c {
+
+int32_t motor_move_voltage(uint8_t port, const int32_t voltage) {
+  sim::Motor* m = motor_get(port);
+  if (!m) return PROS_ERR;
+  m->mode = sim::Motor::VOLTAGE;
+  m->pending_voltage = std::clamp<int32_t>(voltage, -12000, 12000) * sign(*m);
+  m->pending_time = millis() + sim::MOTOR_COMMAND_LATENCY_MS;
+  m->pending = true;
+  return 1;
+}
+
+int32_t motor_move(uint8_t port, int32_t voltage) { return motor_move_voltage(port, std::clamp<int32_t>(voltage, -127, 127) * 12000 / 127); }
+
+int32_t motor_move_velocity(uint8_t port, const int32_t velocity) {
+  sim::Motor* m = motor_get(port);
+  if (!m) return PROS_ERR;
+  m->mode = sim::Motor::VELOCITY;
+  m->target_velocity = velocity * sign(*m);
+  m->pending = false;
+  return 1;
+}
+
+int32_t motor_move_absolute(uint8_t port, const double position, const int32_t velocity) {
+  sim::Motor* m = motor_get(port);
+  if (!m) return PROS_ERR;
+  m->mode = sim::Motor::POSITION;
+  m->target_position = from_units(*m, position) * sign(*m) + m->zero;
+  m->target_velocity = velocity;
+  m->pending = false;
+  return 1;
+}
+
+int32_t motor_move_relative(uint8_t port, const double position, const int32_t velocity) {
+  sim::Motor* m = motor_get(port);
+  if (!m) return PROS_ERR;
+  m->mode = sim::Motor::POSITION;
+  m->target_position += from_units(*m, position) * sign(*m);
+  m->target_velocity = velocity;
+  m->pending = false;
+  return 1;
+}
+
+int32_t motor_brake(uint8_t port) { return motor_move_velocity(port, 0); }
+
+int32_t motor_modify_profiled_velocity(uint8_t port, const int32_t velocity) {
+  sim::Motor* m = motor_get(port);
+  if (!m) return PROS_ERR;
+  m->target_velocity = velocity;
+  return 1;
+}
+
+double motor_get_target_position(uint8_t port) {
+  sim::Motor* m = motor_get(port);
+  return m ? to_units(*m, (m->target_position - m->zero) * sign(*m)) : PROS_ERR_F;
+}
+
+int32_t motor_get_target_velocity(uint8_t port) {
+  sim::Motor* m = motor_get(port);
+  return m ? m->target_velocity * sign(*m) : PROS_ERR;
+}
+
+double motor_get_actual_velocity(uint8_t port) {
+  sim::Motor* m = motor_get(port);
+  return m ? m->reported_velocity * sign(*m) : PROS_ERR_F;
+}
+
+int32_t motor_get_current_draw(uint8_t port) {
+  sim::Motor* m = motor_get(port);
+  return m ? m->reported_current : PROS_ERR;
+}
+
+int32_t motor_get_direction(uint8_t port) {
+  sim::Motor* m = motor_get(port);
+  return m ? (m->reported_velocity * sign(*m) < 0 ? -1 : 1) : PROS_ERR;
+}
+
+double motor_get_efficiency(uint8_t port) {
+  sim::Motor* m = motor_get(port);
+  if (!m) return PROS_ERR_F;
+  double speed = std::fabs(m->reported_velocity) / m->free_rpm();
+  return std::clamp(100.0 * speed, 0.0, 100.0);
+}
+
+int32_t motor_is_over_current(uint8_t port) {
+  sim::Motor* m = motor_get(port);
+  return m ? m->reported_current >= m->current_limit : PROS_ERR;
+}
+
+int32_t motor_is_over_temp(uint8_t port) {
+  sim::Motor* m = motor_get(port);
+  return m ? m->reported_temperature >= 55 : PROS_ERR;
+}
+
+int32_t motor_is_stopped(uint8_t port) {
+  sim::Motor* m = motor_get(port);
+  return m ? std::fabs(m->reported_velocity) < 1 : PROS_ERR;
+}
+
+int32_t motor_get_zero_position_flag(uint8_t port) {
+  sim::Motor* m = motor_get(port);
+  return m ? std::fabs(m->reported_position - m->zero) < 1 : PROS_ERR;
+}
+
+uint32_t motor_get_faults(uint8_t port) {
+  sim::Motor* m = motor_get(port);
+  return m ? (m->reported_temperature >= 55 ? E_MOTOR_FAULT_MOTOR_OVER_TEMP : E_MOTOR_FAULT_NO_FAULTS) : PROS_ERR;
+}
+
+uint32_t motor_get_flags(uint8_t port) {
+  sim::Motor* m = motor_get(port);
+  return m ? 0 : PROS_ERR;
+}
+
+int32_t motor_get_raw_position(uint8_t port, uint32_t* const timestamp) {
+  sim::Motor* m = motor_get(port);
+  if (!m) return PROS_ERR;
+  if (timestamp) *timestamp = m->reported_time;
+  return std::lround(m->reported_position * sign(*m) / 360.0 * m->counts_per_rev());
+}
+
+double motor_get_position(uint8_t port) {
+  sim::Motor* m = motor_get(port);
+  return m ? to_units(*m, (m->reported_position - m->zero) * sign(*m)) : PROS_ERR_F;
+}
+
+double motor_get_power(uint8_t port) {
+  sim::Motor* m = motor_get(port);
+  return m ? std::fabs(m->volts() * m->reported_current / 1000.0) : PROS_ERR_F;
+}
+
+double motor_get_temperature(uint8_t port) {
+  sim::Motor* m = motor_get(port);
+  return m ? m->reported_temperature : PROS_ERR_F;
+}
+
+double motor_get_torque(uint8_t port) {
+  sim::Motor* m = motor_get(port);
+  // 2.1 Nm stall at the 100 rpm cartridge, scaled by the gear ratio and current
+  return m ? 2.1 * (100.0 / m->free_rpm()) * m->reported_current / 2500.0 : PROS_ERR_F;
+}
+
+int32_t motor_get_voltage(uint8_t port) {
+  sim::Motor* m = motor_get(port);
+  return m ? m->voltage * sign(*m) : PROS_ERR;
+}
+
+int32_t motor_set_zero_position(uint8_t port, const double position) {
+  sim::Motor* m = motor_get(port);
+  if (!m) return PROS_ERR;
+  m->zero = m->reported_position - from_units(*m, position) * sign(*m);
+  return 1;
+}
+
+int32_t motor_tare_position(uint8_t port) {
+  sim::Motor* m = motor_get(port);
+  if (!m) return PROS_ERR;
+  m->zero = m->reported_position;
+  return 1;
+}
+
+int32_t motor_set_brake_mode(uint8_t port, const motor_brake_mode_e_t mode) {
+  sim::Motor* m = motor_get(port);
+  if (!m) return PROS_ERR;
+  m->brake_mode = mode;
+  return 1;
+}
+
+int32_t motor_set_current_limit(uint8_t port, const int32_t limit) {
+  sim::Motor* m = motor_get(port);
+  if (!m) return PROS_ERR;
+  m->current_limit = std::clamp<int32_t>(limit, 0, 2500);
+  return 1;
+}
+
+int32_t motor_set_encoder_units(uint8_t port, const motor_encoder_units_e_t units) {
+  sim::Motor* m = motor_get(port);
+  if (!m) return PROS_ERR;
+  m->encoder_units = units;
+  return 1;
+}
+
+int32_t motor_set_gearing(uint8_t port, const motor_gearset_e_t gearset) {
+  sim::Motor* m = motor_get(port);
+  if (!m) return PROS_ERR;
+  m->gearset = gearset;
+  return 1;
+}
+
+int32_t motor_set_reversed(uint8_t port, const bool reverse) {
+  sim::Motor* m = motor_get(port);
+  if (!m) return PROS_ERR;
+  m->reversed = reverse;
+  return 1;
+}
+
+int32_t motor_set_voltage_limit(uint8_t port, const int32_t) { return motor_get(port) ? 1 : PROS_ERR; }
+
+motor_brake_mode_e_t motor_get_brake_mode(uint8_t port) {
+  sim::Motor* m = motor_get(port);
+  return m ? (motor_brake_mode_e_t)m->brake_mode : E_MOTOR_BRAKE_INVALID;
+}
+
+int32_t motor_get_current_limit(uint8_t port) {
+  sim::Motor* m = motor_get(port);
+  return m ? m->current_limit : PROS_ERR;
+}
+
+motor_encoder_units_e_t motor_get_encoder_units(uint8_t port) {
+  sim::Motor* m = motor_get(port);
+  return m ? (motor_encoder_units_e_t)m->encoder_units : E_MOTOR_ENCODER_INVALID;
+}
+
+motor_gearset_e_t motor_get_gearing(uint8_t port) {
+  sim::Motor* m = motor_get(port);
+  return m ? (motor_gearset_e_t)m->gearset : E_MOTOR_GEARSET_INVALID;
+}
+
+int32_t motor_is_reversed(uint8_t port) {
+  sim::Motor* m = motor_get(port);
+  return m ? m->reversed : PROS_ERR;
+}
+
+int32_t motor_get_voltage_limit(uint8_t port) { return motor_get(port) ? 0 : PROS_ERR; }
+
+}  // namespace c
+
+using namespace pros::c;
+
+Motor::Motor(const std::int8_t port, const motor_gearset_e_t gearset, const bool reverse, const motor_encoder_units_e_t encoder_units)
+    : _port(std::abs(port)) {
+  set_gearing(gearset);
+  set_reversed(reverse);
+  set_encoder_units(encoder_units);
+}
+
+Motor::Motor(const std::int8_t port, const motor_gearset_e_t gearset, const bool reverse) : _port(std::abs(port)) {
+  set_gearing(gearset);
+  set_reversed(reverse);
+}
+
+Motor::Motor(const std::int8_t port, const motor_gearset_e_t gearset) : _port(std::abs(port)) {
+  set_gearing(gearset);
+  set_reversed(port < 0);
+}
+
+Motor::Motor(const std::int8_t port, const bool reverse) : _port(std::abs(port)) { set_reversed(reverse); }
+
+Motor::Motor(const std::int8_t port) : _port(std::abs(port)) { set_reversed(port < 0); }
+
+std::int32_t Motor::operator=(std::int32_t voltage) const { return move(voltage); }
+std::int32_t Motor::move(std::int32_t voltage) const { return motor_move(_port, voltage); }
+std::int32_t Motor::move_absolute(const double position, const std::int32_t velocity) const { return motor_move_absolute(_port, position, velocity); }
+std::int32_t Motor::move_relative(const double position, const std::int32_t velocity) const { return motor_move_relative(_port, position, velocity); }
+std::int32_t Motor::move_velocity(const std::int32_t velocity) const { return motor_move_velocity(_port, velocity); }
+std::int32_t Motor::move_voltage(const std::int32_t voltage) const { return motor_move_voltage(_port, voltage); }
+std::int32_t Motor::brake(void) const { return motor_brake(_port); }
+std::int32_t Motor::modify_profiled_velocity(const std::int32_t velocity) const { return motor_modify_profiled_velocity(_port, velocity); }
+double Motor::get_target_position(void) const { return motor_get_target_position(_port); }
+std::int32_t Motor::get_target_velocity(void) const { return motor_get_target_velocity(_port); }
+double Motor::get_actual_velocity(void) const { return motor_get_actual_velocity(_port); }
+std::int32_t Motor::get_current_draw(void) const { return motor_get_current_draw(_port); }
+std::int32_t Motor::get_direction(void) const { return motor_get_direction(_port); }
+double Motor::get_efficiency(void) const { return motor_get_efficiency(_port); }
+std::int32_t Motor::is_over_current(void) const { return motor_is_over_current(_port); }
+std::int32_t Motor::is_stopped(void) const { return motor_is_stopped(_port); }
+std::int32_t Motor::get_zero_position_flag(void) const { return motor_get_zero_position_flag(_port); }
+std::uint32_t Motor::get_faults(void) const { return motor_get_faults(_port); }
+std::uint32_t Motor::get_flags(void) const { return motor_get_flags(_port); }
+std::int32_t Motor::get_raw_position(std::uint32_t* const timestamp) const { return motor_get_raw_position(_port, timestamp); }
+std::int32_t Motor::is_over_temp(void) const { return motor_is_over_temp(_port); }
+double Motor::get_position(void) const { return motor_get_position(_port); }
+double Motor::get_power(void) const { return motor_get_power(_port); }
+double Motor::get_temperature(void) const { return motor_get_temperature(_port); }
+double Motor::get_torque(void) const { return motor_get_torque(_port); }
+std::int32_t Motor::get_voltage(void) const { return motor_get_voltage(_port); }
+std::int32_t Motor::set_zero_position(const double position) const { return motor_set_zero_position(_port, position); }
+std::int32_t Motor::tare_position(void) const { return motor_tare_position(_port); }
+std::int32_t Motor::set_brake_mode(const motor_brake_mode_e_t mode) const { return motor_set_brake_mode(_port, mode); }
+std::int32_t Motor::set_current_limit(const std::int32_t limit) const { return motor_set_current_limit(_port, limit); }
+std::int32_t Motor::set_encoder_units(const motor_encoder_units_e_t units) const { return motor_set_encoder_units(_port, units); }
+std::int32_t Motor::set_gearing(const motor_gearset_e_t gearset) const { return motor_set_gearing(_port, gearset); }
+std::int32_t Motor::set_pos_pid(const motor_pid_s_t) const { return 1; }
+std::int32_t Motor::set_pos_pid_full(const motor_pid_full_s_t) const { return 1; }
+std::int32_t Motor::set_vel_pid(const motor_pid_s_t) const { return 1; }
+std::int32_t Motor::set_vel_pid_full(const motor_pid_full_s_t) const { return 1; }
+std::int32_t Motor::set_reversed(const bool reverse) const { return motor_set_reversed(_port, reverse); }
+std::int32_t Motor::set_voltage_limit(const std::int32_t limit) const { return motor_set_voltage_limit(_port, limit); }
+motor_brake_mode_e_t Motor::get_brake_mode(void) const { return motor_get_brake_mode(_port); }
+std::int32_t Motor::get_current_limit(void) const { return motor_get_current_limit(_port); }
+motor_encoder_units_e_t Motor::get_encoder_units(void) const { return motor_get_encoder_units(_port); }
+motor_gearset_e_t Motor::get_gearing(void) const { return motor_get_gearing(_port); }
+motor_pid_full_s_t Motor::get_pos_pid(void) const { return {}; }
+motor_pid_full_s_t Motor::get_vel_pid(void) const { return {}; }
+std::int32_t Motor::is_reversed(void) const { return motor_is_reversed(_port); }
+std::int32_t Motor::get_voltage_limit(void) const { return motor_get_voltage_limit(_port); }
+std::uint8_t Motor::get_port(void) const { return _port; }
+
+Motor_Group::Motor_Group(const std::initializer_list<Motor> motors) : _motors(motors), _motor_count(motors.size()) {}
+
+Motor_Group::Motor_Group(const std::vector<pros::Motor>& motors) : _motors(motors), _motor_count(motors.size()) {}
+
+Motor_Group::Motor_Group(const std::initializer_list<std::int8_t> motor_ports) : _motor_count(motor_ports.size()) {
+  for (auto port : motor_ports) _motors.emplace_back(port);
+}
+
+Motor_Group::Motor_Group(const std::vector<std::int8_t> motor_ports) : _motor_count(motor_ports.size()) {
+  for (auto port : motor_ports) _motors.emplace_back(port);
+}
+
+// Runs f on every motor, returns PROS_ERR if any of them failed
+template <class F>
+static std::int32_t each(std::vector<Motor>& motors, F f) {
+  std::int32_t out = 1;
+  for (auto& motor : motors) {
+    if (f(motor) == PROS_ERR) out = PROS_ERR;
+  }
+  return out;
+}
+
+std::int32_t Motor_Group::operator=(std::int32_t voltage) { return move(voltage); }
+std::int32_t Motor_Group::move(std::int32_t voltage) { return each(_motors, [&](Motor& m) { return m.move(voltage); }); }
+std::int32_t Motor_Group::move_absolute(const double position, const std::int32_t velocity) { return each(_motors, [&](Motor& m) { return m.move_absolute(position, velocity); }); }
+std::int32_t Motor_Group::move_relative(const double position, const std::int32_t velocity) { return each(_motors, [&](Motor& m) { return m.move_relative(position, velocity); }); }
+std::int32_t Motor_Group::move_velocity(const std::int32_t velocity) { return each(_motors, [&](Motor& m) { return m.move_velocity(velocity); }); }
+std::int32_t Motor_Group::move_voltage(const std::int32_t voltage) { return each(_motors, [&](Motor& m) { return m.move_voltage(voltage); }); }
+std::int32_t Motor_Group::brake(void) { return each(_motors, [&](Motor& m) { return m.brake(); }); }
+std::int32_t Motor_Group::set_zero_position(const double position) { return each(_motors, [&](Motor& m) { return m.set_zero_position(position); }); }
+std::int32_t Motor_Group::set_brake_modes(motor_brake_mode_e_t mode) { return each(_motors, [&](Motor& m) { return m.set_brake_mode(mode); }); }
+std::int32_t Motor_Group::set_reversed(const bool reversed) { return each(_motors, [&](Motor& m) { return m.set_reversed(reversed); }); }
+std::int32_t Motor_Group::set_voltage_limit(const std::int32_t limit) { return each(_motors, [&](Motor& m) { return m.set_voltage_limit(limit); }); }
+std::int32_t Motor_Group::set_gearing(const motor_gearset_e_t gearset) { return each(_motors, [&](Motor& m) { return m.set_gearing(gearset); }); }
+std::int32_t Motor_Group::set_encoder_units(const motor_encoder_units_e_t units) { return each(_motors, [&](Motor& m) { return m.set_encoder_units(units); }); }
+std::int32_t Motor_Group::tare_position(void) { return each(_motors, [&](Motor& m) { return m.tare_position(); }); }
+pros::Motor& Motor_Group::operator[](int i) { return _motors[i]; }
+pros::Motor& Motor_Group::at(int i) { return _motors.at(i); }
+std::int32_t Motor_Group::size() { return _motor_count; }
+
+std::vector<double> Motor_Group::get_actual_velocities(void) {
+  std::vector<double> out;
+  for (auto& motor : _motors) out.push_back(motor.get_actual_velocity());
+  return out;
+}
+
+std::vector<double> Motor_Group::get_positions(void) {
+  std::vector<double> out;
+  for (auto& motor : _motors) out.push_back(motor.get_position());
+  return out;
+}
+
+std::vector<std::int32_t> Motor_Group::get_current_draws(void) {
+  std::vector<std::int32_t> out;
+  for (auto& motor : _motors) out.push_back(motor.get_current_draw());
+  return out;
+}
+
+std::vector<double> Motor_Group::get_temperatures(void) {
+  std::vector<double> out;
+  for (auto& motor : _motors) out.push_back(motor.get_temperature());
+  return out;
+}
+
+std::vector<std::uint8_t> Motor_Group::get_ports(void) {
+  std::vector<std::uint8_t> out;
+  for (auto& motor : _motors) out.push_back(motor.get_port());
+  return out;
+}
+
+}  // namespace pros
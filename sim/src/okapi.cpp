@@ -0,0 +1,30 @@
+// The parts of OkapiLib the robot code uses, okapilib.a is ARM only.  These follow OkapiLib's
+// own implementations
+
+#include "okapi/api/filter/ekfFilter.hpp"
+
+namespace okapi {
+Filter::~Filter() = default;
+
+EKFFilter::EKFFilter(const double iQ, const double iR) : Q(iQ), R(iR) {}
+
+double EKFFilter::filter(const double ireading) { return filter(ireading, 0); }
+
+double EKFFilter::filter(const double ireading, const double icontrol) {
+  // Time update
+  xHatMinus = xHatPrev + icontrol;
+  Pminus = Pprev + Q;
+
+  // Measurement update
+  K = Pminus / (Pminus + R);
+  xHat = xHatMinus + K * (ireading - xHatMinus);
+  P = (1 - K) * Pminus;
+
+  xHatPrev = xHat;
+  Pprev = P;
+
+  return xHat;
+}
+
+double EKFFilter::getOutput() const { return xHat; }
+}  // namespace okapi
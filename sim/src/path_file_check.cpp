@@ -0,0 +1,126 @@
+// Checks path files on the host, the same code path_file_load() runs on the brain:
+//
+//   path_file_check
+//
+// A path written with path_file_write() has to parse back to the same points, and a file that's
+// truncated, too long, claims more points than it has, or fails its CRC has to be rejected
+// before anything reads the columns.  Exits non zero if a check fails.
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "path_file.hpp"
+
+namespace {
+int failures = 0;
+
+void check(bool ok, const char* what, unsigned long got, unsigned long expected) {
+  std::printf("%s %s (got %lu, expected %lu)\n", ok ? "pass" : "FAIL", what, got, expected);
+  if (!ok) failures++;
+}
+
+void check_equal(const char* what, unsigned long got, unsigned long expected) { check(got == expected, what, got, expected); }
+
+constexpr std::uint32_t COUNT = 5;
+const float X[COUNT] = {0, 1, 2, 3, 4};
+const float Y[COUNT] = {0, 0.5f, 1, 1.5f, 2};
+const float THETA[COUNT] = {90, 89, 88, 87, 86};
+const float VELOCITY[COUNT] = {0, 10, 20, 10, 0};
+const float CURVATURE[COUNT] = {0, 0.01f, 0.02f, 0.01f, 0};
+const float DISTANCE[COUNT] = {0, 1.1f, 2.2f, 3.3f, 4.4f};
+const PathProfile PATH = {"check", COUNT, 0.01f, false, X, Y, THETA, VELOCITY, CURVATURE, DISTANCE};
+
+// A file image of PATH with a byte of room past the end, 4 byte aligned like path_file_parse() wants
+struct Image {
+  alignas(4) std::uint8_t data[1024];
+  std::size_t size;
+};
+
+Image image_write() {
+  Image image = {};
+  image.size = path_file_write(PATH, image.data);
+  return image;
+}
+
+void round_trip_check() {
+  Image image = image_write();
+  check_equal("file size", image.size, path_file_size(COUNT));
+
+  PathProfile path = {};
+  check_equal("file parses", path_file_parse(image.data, image.size, path), 1);
+  check_equal("count", path.count, COUNT);
+  check_equal("name", !std::strcmp(path.name ? path.name : "", "check"), 1);
+  bool same = true;
+  for (std::uint32_t i = 0; i < COUNT && path.count == COUNT; i++) {
+    PathPoint a = path.point(i);
+    PathPoint b = PATH.point(i);
+    same &= !std::memcmp(&a, &b, sizeof(a));
+  }
+  check_equal("points come back the same", same, 1);
+
+  PathProfile long_name = PATH;
+  long_name.name = "a name that doesn't fit in the header";
+  check_equal("name too long isn't written", path_file_write(long_name, image.data), 0);
+}
+
+void reject_check() {
+  PathProfile path;
+  Image image = image_write();
+  check_equal("truncated by a byte", path_file_parse(image.data, image.size - 1, path), 0);
+  check_equal("truncated to the header", path_file_parse(image.data, sizeof(PathFileHeader), path), 0);
+  check_equal("shorter than the header", path_file_parse(image.data, sizeof(PathFileHeader) - 1, path), 0);
+  check_equal("a point too long", path_file_parse(image.data, image.size + PATH_FILE_COLUMNS * sizeof(float), path), 0);
+  check_equal("not 4 byte aligned", path_file_parse(image.data + 1, image.size, path), 0);
+
+  // The header's count is checked against the size before the CRC is worked out over it
+  PathFileHeader* header = (PathFileHeader*)image.data;
+  for (std::uint32_t count : {0u, COUNT + 1, 0x10000000u, 0xffffffffu}) {
+    header->count = count;
+    char what[48];
+    std::snprintf(what, sizeof(what), "header count of %lu", (unsigned long)count);
+    check_equal(what, path_file_parse(image.data, image.size, path), 0);
+  }
+
+  image = image_write();
+  image.data[image.size - 1] ^= 0x01;
+  check_equal("flipped bit in a column", path_file_parse(image.data, image.size, path), 0);
+  image = image_write();
+  image.data[0] = 'X';
+  check_equal("wrong magic", path_file_parse(image.data, image.size, path), 0);
+  image = image_write();
+  header = (PathFileHeader*)image.data;
+  header->version = PATH_FILE_VERSION + 1;
+  check_equal("newer version", path_file_parse(image.data, image.size, path), 0);
+}
+
+// path_file_load() only gets one fread, a file bigger than the buffer mustn't parse as its start
+void load_check() {
+  const char* filename = "/tmp/path_file_check.ezp";
+  Image image = image_write();
+  FILE* file = std::fopen(filename, "wb");
+  if (!file) {
+    std::perror(filename);
+    failures++;
+    return;
+  }
+  std::fwrite(image.data, 1, image.size, file);
+  std::fclose(file);
+
+  PathProfile path;
+  alignas(4) static std::uint8_t buffer[1024];
+  check_equal("file loads", path_file_load(filename, buffer, sizeof(buffer), path), 1);
+  check_equal("file that fills the buffer exactly loads", path_file_load(filename, buffer, image.size, path), 1);
+  check_equal("file bigger than the buffer", path_file_load(filename, buffer, image.size - 1, path), 0);
+  check_equal("missing file", path_file_load("/tmp/path_file_check_missing.ezp", buffer, sizeof(buffer), path), 0);
+  std::remove(filename);
+}
+}  // namespace
+
+int main() {
+  round_trip_check();
+  reject_check();
+  load_check();
+  std::printf("%s\n", failures ? "path_file_check: FAILED" : "path_file_check: all passed");
+  return failures ? 1 : 0;
+}
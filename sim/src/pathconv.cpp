@@ -0,0 +1,101 @@
+// Converts paths to and from the binary path files path_file_load() reads off the SD card:
+//
+//   pathconv --export <dir>        every path in paths.hpp as <dir>/<name>.ezp
+//   pathconv <in.csv> <out.ezp>    x,y,theta,velocity,curvature,distance rows, 10ms apart
+//   pathconv <in.ezp>              checks a path file and prints it as CSV
+//
+// CSV paths are named after their file, and reversed if they have negative velocities.  Copy
+// the .ezp files to the root of the SD card.
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "path_file.hpp"
+#include "paths.hpp"
+
+namespace {
+bool file_write(const std::string& filename, const PathProfile& path) {
+  std::vector<std::uint8_t> image(path_file_size(path.count));
+  if (!path_file_write(path, image.data())) {
+    std::fprintf(stderr, "pathconv: %s's name is longer than %zu characters\n", path.name, PATH_FILE_NAME_SIZE - 1);
+    return false;
+  }
+  FILE* file = std::fopen(filename.c_str(), "wb");
+  if (!file || std::fwrite(image.data(), 1, image.size(), file) != image.size()) {
+    std::perror(filename.c_str());
+    if (file) std::fclose(file);
+    return false;
+  }
+  std::fclose(file);
+  std::printf("pathconv: %s, %u points, %zu bytes\n", filename.c_str(), (unsigned)path.count, image.size());
+  return true;
+}
+
+int csv_convert(const char* input, const char* output) {
+  FILE* file = std::fopen(input, "r");
+  if (!file) {
+    std::perror(input);
+    return 1;
+  }
+  std::vector<float> columns[PATH_FILE_COLUMNS];
+  char line[256];
+  while (std::fgets(line, sizeof(line), file)) {
+    float v[PATH_FILE_COLUMNS];
+    // Skips the header and anything else that isn't a row
+    if (std::sscanf(line, "%f,%f,%f,%f,%f,%f", &v[0], &v[1], &v[2], &v[3], &v[4], &v[5]) != PATH_FILE_COLUMNS) continue;
+    for (int i = 0; i < PATH_FILE_COLUMNS; i++) columns[i].push_back(v[i]);
+  }
+  std::fclose(file);
+  if (columns[0].empty()) {
+    std::fprintf(stderr, "pathconv: %s has no rows\n", input);
+    return 1;
+  }
+
+  std::string name = input;
+  name = name.substr(name.find_last_of('/') + 1);
+  name = name.substr(0, name.find('.'));
+  PathProfile path = {name.c_str(), (std::uint32_t)columns[0].size(), 0.01f, false,
+                      columns[0].data(), columns[1].data(), columns[2].data(), columns[3].data(), columns[4].data(), columns[5].data()};
+  for (float velocity : columns[3])
+    if (velocity < 0) path.reversed = true;
+  return file_write(output, path) ? 0 : 1;
+}
+
+int file_print(const char* input) {
+  FILE* file = std::fopen(input, "rb");
+  if (!file) {
+    std::perror(input);
+    return 1;
+  }
+  std::fseek(file, 0, SEEK_END);
+  std::vector<float> buffer((std::ftell(file) + sizeof(float) - 1) / sizeof(float));
+  std::fclose(file);
+
+  PathProfile path;
+  auto* data = (std::uint8_t*)buffer.data();
+  if (!path_file_load(input, data, buffer.size() * sizeof(float), path)) {
+    std::fprintf(stderr, "pathconv: %s isn't a valid path file\n", input);
+    return 1;
+  }
+  std::fprintf(stderr, "pathconv: %s, %u points, %.3fs apart%s\n", path.name, (unsigned)path.count, path.dt, path.reversed ? ", reversed" : "");
+  std::printf("x,y,theta,velocity,curvature,distance\n");
+  for (std::uint32_t i = 0; i < path.count; i++)
+    std::printf("%.9g,%.9g,%.9g,%.9g,%.9g,%.9g\n", path.x[i], path.y[i], path.theta[i], path.velocity[i], path.curvature[i], path.distance[i]);
+  return 0;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc == 3 && !std::strcmp(argv[1], "--export")) {
+    for (const PathProfile* path : PATHS)
+      if (!file_write(std::string(argv[2]) + "/" + path->name + ".ezp", *path)) return 1;
+    return 0;
+  }
+  if (argc == 3 && argv[1][0] != '-') return csv_convert(argv[1], argv[2]);
+  if (argc == 2 && argv[1][0] != '-') return file_print(argv[1]);
+
+  std::printf("usage: %s --export <dir> | <in.csv> <out.ezp> | <in.ezp>\n", argv[0]);
+  return 2;
+}
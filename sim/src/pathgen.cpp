@@ -0,0 +1,191 @@
+// Generates motion profiles for every path in include/path_specs.hpp:
+//
+//   pathgen <paths.cpp> <paths.hpp>
+//
+// `make paths` runs this after path_specs.hpp is edited, the output is committed so a checkout
+// builds without it.  This is the same thing squiggles::SplineGenerator does on the
+// brain (quintic Hermite splines through the waypoints, a curvature limited velocity and an
+// acceleration limit both ways), just run here so the brain never spends time on it.
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "path_profile.hpp"
+#include "path_specs.hpp"
+
+namespace {
+constexpr double DT = 0.01;              // s, matches the drive task
+constexpr int SAMPLES_PER_SEGMENT = 2000;  // arc length integration steps between two waypoints
+constexpr double TANGENT_SCALE = 1.2;    // waypoint derivative, as a fraction of the chord
+
+// A point along the spline, before it's timed
+struct Sample {
+  double x, y;
+  double heading;  // direction of travel
+  double curvature;
+  double distance;
+  double velocity;
+};
+
+double to_rad(double deg) { return deg * M_PI / 180.0; }
+double to_deg(double rad) { return rad * 180.0 / M_PI; }
+
+// -180 to 180
+double angle_wrap(double angle) {
+  angle = std::fmod(angle + 180.0, 360.0);
+  if (angle < 0) angle += 360.0;
+  return angle - 180.0;
+}
+
+// Samples every segment of the spline.  Second derivatives at the waypoints are 0, like squiggles
+std::vector<Sample> spline_sample(const PathSpec& spec) {
+  std::vector<Sample> samples;
+  double distance = 0;
+  for (int i = 0; i + 1 < spec.count; i++) {
+    PathWaypoint a = spec.waypoints[i];
+    PathWaypoint b = spec.waypoints[i + 1];
+    // Travel is opposite the way a reversed robot faces
+    double flip = spec.reversed ? 180.0 : 0.0;
+    double chord = std::hypot(b.x - a.x, b.y - a.y) * TANGENT_SCALE;
+    double ax = chord * std::sin(to_rad(a.theta + flip)), ay = chord * std::cos(to_rad(a.theta + flip));
+    double bx = chord * std::sin(to_rad(b.theta + flip)), by = chord * std::cos(to_rad(b.theta + flip));
+
+    for (int j = i == 0 ? 0 : 1; j <= SAMPLES_PER_SEGMENT; j++) {
+      double t = (double)j / SAMPLES_PER_SEGMENT;
+      double t2 = t * t, t3 = t2 * t, t4 = t3 * t, t5 = t4 * t;
+      // Quintic Hermite basis for p0, v0, v1, p1 and their first and second derivatives
+      double h[4] = {1 - 10 * t3 + 15 * t4 - 6 * t5, t - 6 * t3 + 8 * t4 - 3 * t5, -4 * t3 + 7 * t4 - 3 * t5, 10 * t3 - 15 * t4 + 6 * t5};
+      double d[4] = {-30 * t2 + 60 * t3 - 30 * t4, 1 - 18 * t2 + 32 * t3 - 15 * t4, -12 * t2 + 28 * t3 - 15 * t4, 30 * t2 - 60 * t3 + 30 * t4};
+      double dd[4] = {-60 * t + 180 * t2 - 120 * t3, -36 * t + 96 * t2 - 60 * t3, -24 * t + 84 * t2 - 60 * t3, 60 * t - 180 * t2 + 120 * t3};
+
+      Sample s;
+      s.x = h[0] * a.x + h[1] * ax + h[2] * bx + h[3] * b.x;
+      s.y = h[0] * a.y + h[1] * ay + h[2] * by + h[3] * b.y;
+      double dx = d[0] * a.x + d[1] * ax + d[2] * bx + d[3] * b.x;
+      double dy = d[0] * a.y + d[1] * ay + d[2] * by + d[3] * b.y;
+      double ddx = dd[0] * a.x + dd[1] * ax + dd[2] * bx + dd[3] * b.x;
+      double ddy = dd[0] * a.y + dd[1] * ay + dd[2] * by + dd[3] * b.y;
+      double speed = std::hypot(dx, dy);
+      s.heading = to_deg(std::atan2(dx, dy));
+      // x right, y forward is counterclockwise positive for the cross product
+      s.curvature = speed > 1e-9 ? -(dx * ddy - dy * ddx) / (speed * speed * speed) : 0;
+
+      if (!samples.empty()) distance += std::hypot(s.x - samples.back().x, s.y - samples.back().y);
+      s.distance = distance;
+      s.velocity = 0;
+      samples.push_back(s);
+    }
+  }
+  return samples;
+}
+
+// Fastest velocity at every sample that keeps the outside wheel under max_velocity, and
+// accelerates and decelerates within max_acceleration from a stop to a stop
+void velocity_limit(std::vector<Sample>& samples, const PathConstraints& constraints) {
+  for (Sample& s : samples) s.velocity = constraints.max_velocity / (1.0 + std::fabs(s.curvature) * constraints.track_width / 2.0);
+
+  samples.front().velocity = 0;
+  for (std::size_t i = 1; i < samples.size(); i++) {
+    double ds = samples[i].distance - samples[i - 1].distance;
+    samples[i].velocity = std::fmin(samples[i].velocity, std::sqrt(samples[i - 1].velocity * samples[i - 1].velocity + 2 * constraints.max_acceleration * ds));
+  }
+  samples.back().velocity = 0;
+  for (std::size_t i = samples.size() - 1; i-- > 0;) {
+    double ds = samples[i + 1].distance - samples[i].distance;
+    samples[i].velocity = std::fmin(samples[i].velocity, std::sqrt(samples[i + 1].velocity * samples[i + 1].velocity + 2 * constraints.max_acceleration * ds));
+  }
+}
+
+PathPoint point_make(const Sample& s, bool reversed) {
+  double theta = angle_wrap(s.heading + (reversed ? 180.0 : 0.0));
+  return {(float)s.x, (float)s.y, (float)theta, (float)(reversed ? -s.velocity : s.velocity), (float)s.curvature, (float)s.distance};
+}
+
+// Times the samples, then picks the one at every DT
+std::vector<PathPoint> profile_make(const PathSpec& spec) {
+  std::vector<Sample> samples = spline_sample(spec);
+  velocity_limit(samples, spec.constraints);
+
+  std::vector<double> time(samples.size(), 0.0);
+  for (std::size_t i = 1; i < samples.size(); i++) {
+    double ds = samples[i].distance - samples[i - 1].distance;
+    double v = samples[i].velocity + samples[i - 1].velocity;
+    time[i] = time[i - 1] + (v > 0 ? 2 * ds / v : 0);
+  }
+
+  std::vector<PathPoint> points;
+  std::size_t j = 0;
+  for (int k = 0; k * DT < time.back(); k++) {
+    double t = k * DT;
+    while (j + 2 < samples.size() && time[j + 1] <= t) j++;
+    const Sample& a = samples[j];
+    const Sample& b = samples[j + 1];
+    double f = time[j + 1] > time[j] ? (t - time[j]) / (time[j + 1] - time[j]) : 0;
+    Sample s;
+    s.x = a.x + (b.x - a.x) * f;
+    s.y = a.y + (b.y - a.y) * f;
+    s.heading = a.heading + angle_wrap(b.heading - a.heading) * f;
+    s.curvature = a.curvature + (b.curvature - a.curvature) * f;
+    s.distance = a.distance + (b.distance - a.distance) * f;
+    s.velocity = a.velocity + (b.velocity - a.velocity) * f;
+    points.push_back(point_make(s, spec.reversed));
+  }
+  points.push_back(point_make(samples.back(), spec.reversed));
+  return points;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc != 3) {
+    std::printf("usage: %s <paths.cpp> <paths.hpp>\n", argv[0]);
+    return 2;
+  }
+  FILE* source = std::fopen(argv[1], "w");
+  FILE* header = std::fopen(argv[2], "w");
+  if (!source || !header) {
+    std::perror("pathgen");
+    return 1;
+  }
+
+  const char* banner = "// Generated by sim/bin/pathgen from include/path_specs.hpp, edit that instead\n";
+  std::fprintf(header, "#pragma once\n\n%s\n#include \"path_profile.hpp\"\n\n", banner);
+  std::fprintf(source, "%s\n#include \"paths.hpp\"\n", banner);
+
+  for (const PathSpec& spec : PATH_SPECS) {
+    if (spec.count < 2) {
+      std::fprintf(stderr, "pathgen: %s needs at least 2 waypoints\n", spec.name);
+      return 1;
+    }
+    std::vector<PathPoint> points = profile_make(spec);
+    std::fprintf(header, "extern const PathProfile path_%s;\n", spec.name);
+
+    std::fprintf(source, "\n// %zu points, %.2fs, %.1fin\n", points.size(), (points.size() - 1) * DT, points.back().distance);
+    // One array per PathPoint field
+    const char* fields[] = {"x", "y", "theta", "velocity", "curvature", "distance"};
+    for (int field = 0; field < 6; field++) {
+      std::fprintf(source, "static const float %s_%s[] = {", spec.name, fields[field]);
+      for (std::size_t i = 0; i < points.size(); i++) {
+        const PathPoint& p = points[i];
+        float values[] = {p.x, p.y, p.theta, p.velocity, p.curvature, p.distance};
+        std::fprintf(source, "%s%.5ff,", i % 10 == 0 ? "\n    " : " ", values[field]);
+      }
+      std::fprintf(source, "\n};\n");
+    }
+    std::fprintf(source, "const PathProfile path_%s = {\"%s\", %zu, %.3ff, %s", spec.name, spec.name, points.size(), DT, spec.reversed ? "true" : "false");
+    for (const char* field : fields) std::fprintf(source, ", %s_%s", spec.name, field);
+    std::fprintf(source, "};\n");
+    std::printf("pathgen: %s, %zu points, %.2fs\n", spec.name, points.size(), (points.size() - 1) * DT);
+  }
+
+  // Every path, for tools like pathconv that go through all of them
+  int count = sizeof(PATH_SPECS) / sizeof(PATH_SPECS[0]);
+  std::fprintf(header, "\nconstexpr int PATH_COUNT = %d;\nextern const PathProfile* const PATHS[PATH_COUNT];\n", count);
+  std::fprintf(source, "\nconst PathProfile* const PATHS[PATH_COUNT] = {");
+  for (int i = 0; i < count; i++) std::fprintf(source, "%s&path_%s", i ? ", " : "", PATH_SPECS[i].name);
+  std::fprintf(source, "};\n");
+
+  std::fclose(source);
+  std::fclose(header);
+  return 0;
+}
@@ -0,0 +1,165 @@
+// PROS RTOS on the virtual time kernel
+
+#include <cstring>
+
+#include "pros/rtos.hpp"
+#include "sim/kernel.hpp"
+
+using sim::Kernel;
+using sim::TaskControl;
+
+namespace {
+struct SimMutex {
+  TaskControl* owner = nullptr;
+  int depth = 0;
+};
+}  // namespace
+
+namespace pros {
+namespace c {
+
+uint32_t millis(void) { return Kernel::get().millis(); }
+
+uint64_t micros(void) { return Kernel::get().micros(); }
+
+void task_delay(const uint32_t milliseconds) { Kernel::get().delay(milliseconds); }
+
+void delay(const uint32_t milliseconds) { Kernel::get().delay(milliseconds); }
+
+void task_delay_until(uint32_t* const prev_time, const uint32_t delta) { Kernel::get().delay_until(prev_time, delta); }
+
+task_t task_create(task_fn_t function, void* const parameters, uint32_t prio, const uint16_t, const char* const name) {
+  return Kernel::get().create(function, parameters, prio, name);
+}
+
+void task_delete(task_t task) { Kernel::get().remove(static_cast<TaskControl*>(task)); }
+
+uint32_t task_get_priority(task_t task) { return task ? static_cast<TaskControl*>(task)->prio : Kernel::get().current()->prio; }
+
+void task_set_priority(task_t task, uint32_t prio) { (task ? static_cast<TaskControl*>(task) : Kernel::get().current())->prio = prio; }
+
+task_state_e_t task_get_state(task_t task) {
+  TaskControl* t = static_cast<TaskControl*>(task);
+  if (!t) return E_TASK_STATE_INVALID;
+  if (t->done) return E_TASK_STATE_DELETED;
+  if (t == Kernel::get().current()) return E_TASK_STATE_RUNNING;
+  if (t->suspended) return E_TASK_STATE_SUSPENDED;
+  return t->wake > Kernel::get().micros() ? E_TASK_STATE_BLOCKED : E_TASK_STATE_READY;
+}
+
+void task_suspend(task_t task) { Kernel::get().suspend(static_cast<TaskControl*>(task)); }
+
+void task_resume(task_t task) { Kernel::get().resume(static_cast<TaskControl*>(task)); }
+
+uint32_t task_get_count(void) { return Kernel::get().count(); }
+
+char* task_get_name(task_t task) {
+  TaskControl* t = task ? static_cast<TaskControl*>(task) : Kernel::get().current();
+  return const_cast<char*>(t->name.c_str());
+}
+
+task_t task_get_current() { return Kernel::get().current(); }
+
+uint32_t task_notify(task_t task) { return Kernel::get().notify(static_cast<TaskControl*>(task)); }
+
+uint32_t task_notify_take(bool clear_on_exit, uint32_t timeout) { return Kernel::get().notify_take(clear_on_exit, timeout); }
+
+bool task_notify_clear(task_t task) {
+  TaskControl* t = static_cast<TaskControl*>(task);
+  bool was_pending = t->notify_value != 0;
+  t->notify_value = 0;
+  return was_pending;
+}
+
+void task_join(task_t task) {
+  while (task_get_state(task) != E_TASK_STATE_DELETED) Kernel::get().delay(1);
+}
+
+mutex_t mutex_create(void) { return new SimMutex(); }
+
+bool mutex_take(mutex_t mutex, uint32_t timeout) {
+  SimMutex* m = static_cast<SimMutex*>(mutex);
+  TaskControl* self = Kernel::get().current();
+  std::uint32_t start = Kernel::get().millis();
+  // Tasks only switch when they block, so a held mutex is only ever held by a task that's delaying
+  while (m->owner && m->owner != self) {
+    if (timeout != TIMEOUT_MAX && Kernel::get().millis() - start >= timeout) return false;
+    Kernel::get().delay(1);
+  }
+  m->owner = self;
+  m->depth++;
+  return true;
+}
+
+bool mutex_give(mutex_t mutex) {
+  SimMutex* m = static_cast<SimMutex*>(mutex);
+  if (m->owner != Kernel::get().current()) return false;
+  if (--m->depth == 0) m->owner = nullptr;
+  return true;
+}
+
+void mutex_delete(mutex_t mutex) { delete static_cast<SimMutex*>(mutex); }
+
+}  // namespace c
+
+Task::Task(task_fn_t function, void* parameters, std::uint32_t prio, std::uint16_t stack_depth, const char* name) {
+  task = c::task_create(function, parameters, prio, stack_depth, name);
+}
+
+Task::Task(task_fn_t function, void* parameters, const char* name)
+    : Task(function, parameters, TASK_PRIORITY_DEFAULT, TASK_STACK_DEPTH_DEFAULT, name) {}
+
+Task::Task(task_t task) : task(task) {}
+
+Task Task::current() { return Task(c::task_get_current()); }
+
+Task& Task::operator=(const task_t in) {
+  task = in;
+  return *this;
+}
+
+void Task::remove() { c::task_delete(task); }
+
+std::uint32_t Task::get_priority() { return c::task_get_priority(task); }
+
+void Task::set_priority(std::uint32_t prio) { c::task_set_priority(task, prio); }
+
+std::uint32_t Task::get_state() { return c::task_get_state(task); }
+
+void Task::suspend() { c::task_suspend(task); }
+
+void Task::resume() { c::task_resume(task); }
+
+const char* Task::get_name() { return c::task_get_name(task); }
+
+std::uint32_t Task::notify() { return c::task_notify(task); }
+
+void Task::join() { c::task_join(task); }
+
+std::uint32_t Task::notify_take(bool clear_on_exit, std::uint32_t timeout) { return c::task_notify_take(clear_on_exit, timeout); }
+
+bool Task::notify_clear() { return c::task_notify_clear(task); }
+
+void Task::delay(const std::uint32_t milliseconds) { c::task_delay(milliseconds); }
+
+void Task::delay_until(std::uint32_t* const prev_time, const std::uint32_t delta) { c::task_delay_until(prev_time, delta); }
+
+std::uint32_t Task::get_count() { return c::task_get_count(); }
+
+Clock::time_point Clock::now() { return time_point{duration{c::millis()}}; }
+
+Mutex::Mutex() : mutex(c::mutex_create(), c::mutex_delete) {}
+
+bool Mutex::take() { return c::mutex_take(mutex.get(), TIMEOUT_MAX); }
+
+bool Mutex::take(std::uint32_t timeout) { return c::mutex_take(mutex.get(), timeout); }
+
+bool Mutex::give() { return c::mutex_give(mutex.get()); }
+
+void Mutex::lock() { c::mutex_take(mutex.get(), TIMEOUT_MAX); }
+
+void Mutex::unlock() { c::mutex_give(mutex.get()); }
+
+bool Mutex::try_lock() { return c::mutex_take(mutex.get(), 0); }
+
+}  // namespace pros
@@ -0,0 +1,155 @@
+// Host entry point.  Runs the PROS competition lifecycle against the simulated devices:
+//
+//   sim [--auton <page>] [--opcontrol] [--replay <telemetry file>] [--autotune turn|drive] [--imu-noise <deg>] [--profile] [--time <ms>]
+//
+// --auton runs the auton selector page (1 is the first Auton added in initialize()),
+// --opcontrol runs driver control instead, --replay runs driver control with the controller
+// input a telemetry file recorded (the INPUTS records, one per tick), --autotune runs pid_turn_autotune() or
+// pid_drive_autotune() as the autonomous period, --imu-noise adds noise to every IMU reading,
+// --profile prints every profiled task's loop timing at the end, and --time caps how long the
+// period runs.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "main.h"
+#include "sim/competition.hpp"
+#include "sim/devices.hpp"
+#include "sim/kernel.hpp"
+
+namespace {
+struct Options {
+  int auton = 1;
+  bool opcontrol = false;
+  const char* replay = nullptr;
+  const char* autotune = nullptr;
+  double imu_noise = 0;
+  bool profile = false;
+  std::uint32_t time = 0;  // 0 is 15s, 60s for --autotune, or as long as the recording for --replay
+};
+
+const char* USAGE = "usage: %s [--auton <page>] [--opcontrol] [--replay <telemetry file>] [--autotune turn|drive] [--imu-noise <deg>] [--profile] [--time <ms>]\n";
+
+Options options_parse(int argc, char** argv) {
+  Options options;
+  for (int i = 1; i < argc; i++) {
+    if (!std::strcmp(argv[i], "--auton") && i + 1 < argc) {
+      options.auton = std::atoi(argv[++i]);
+    } else if (!std::strcmp(argv[i], "--opcontrol")) {
+      options.opcontrol = true;
+    } else if (!std::strcmp(argv[i], "--replay") && i + 1 < argc) {
+      options.replay = argv[++i];
+      options.opcontrol = true;
+    } else if (!std::strcmp(argv[i], "--autotune") && i + 1 < argc && (!std::strcmp(argv[i + 1], "turn") || !std::strcmp(argv[i + 1], "drive"))) {
+      options.autotune = argv[++i];
+    } else if (!std::strcmp(argv[i], "--imu-noise") && i + 1 < argc) {
+      options.imu_noise = std::atof(argv[++i]);
+    } else if (!std::strcmp(argv[i], "--profile")) {
+      options.profile = true;
+    } else if (!std::strcmp(argv[i], "--time") && i + 1 < argc) {
+      options.time = std::strtoul(argv[++i], nullptr, 10);
+    } else {
+      std::printf(USAGE, argv[0]);
+      std::exit(2);
+    }
+  }
+  if (!options.time && !options.replay) options.time = options.autotune ? 60000 : 15000;
+  return options;
+}
+
+// The INPUTS records of a telemetry file, in the order they were recorded
+std::vector<Telemetry::Record> replay_records;
+std::size_t replay_next = 0;
+
+bool replay_load(const char* path) {
+  FILE* file = std::fopen(path, "rb");
+  if (!file) {
+    std::perror(path);
+    return false;
+  }
+  // The header Telemetry::initialize() writes, "EZTL" then the version and record size
+  std::uint16_t header[4];
+  if (std::fread(header, sizeof(header), 1, file) != 1 || header[0] != 0x5a45 || header[1] != 0x4c54 || header[2] != Telemetry::VERSION ||
+      header[3] != sizeof(Telemetry::Record)) {
+    std::printf("sim: %s isn't a version %u telemetry file\n", path, Telemetry::VERSION);
+    std::fclose(file);
+    return false;
+  }
+  Telemetry::Record record;
+  while (std::fread(&record, sizeof(record), 1, file) == 1)
+    if (record.source == Telemetry::INPUTS) replay_records.push_back(record);
+  std::fclose(file);
+  return true;
+}
+
+// ControllerFrameService::update() calls this every tick instead of reading the controller
+bool replay_frame(std::uint16_t& pressed, std::int8_t (&analog)[ControllerFrame::ANALOG_COUNT]) {
+  if (replay_next == replay_records.size()) return false;
+  const Telemetry::Record& record = replay_records[replay_next++];
+  pressed = record.values[0];
+  for (int i = 0; i < ControllerFrame::ANALOG_COUNT; i++) analog[i] = record.values[i + 1];
+  return true;
+}
+
+void turn_autotune() { chassis.pid_turn_autotune(); }
+void drive_autotune() { chassis.pid_drive_autotune(); }
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options options = options_parse(argc, argv);
+  if (options.replay) {
+    if (!replay_load(options.replay)) return 1;
+    std::printf("sim: replaying %zu controller frames from %s\n", replay_records.size(), options.replay);
+    if (!options.time) options.time = replay_records.size() * ez::util::DELAY_TIME;
+    inputs.replay_set(replay_frame);
+  }
+  sim::Devices& devices = sim::devices();
+  sim::TankPlant& drive = sim::chassis_plant_add();
+  sim::devices_start();
+  for (auto& imu : devices.imus) imu.noise = options.imu_noise;
+
+  devices.competition = COMPETITION_DISABLED | COMPETITION_CONNECTED;
+  initialize();
+  std::uint32_t start = pros::millis();
+  std::printf("sim: initialize() took %lu ms\n", (unsigned long)start);
+  startup.wait();
+  startup.print();
+  if (options.profile) profiler.toggle(true);
+  start = pros::millis();
+
+  bool finished;
+  if (options.opcontrol) {
+    finished = sim::period_run(opcontrol, "User Operator Control (PROS)", COMPETITION_CONNECTED, options.time);
+  } else if (options.autotune) {
+    void (*tune)() = !std::strcmp(options.autotune, "turn") ? turn_autotune : drive_autotune;
+    finished = sim::period_run(tune, "User Autonomous (PROS)", COMPETITION_AUTONOMOUS | COMPETITION_CONNECTED, options.time);
+  } else {
+    if (options.auton < 1 || options.auton > ez::as::auton_selector.auton_count) {
+      std::printf("sim: there is no auton on page %d, there are %d\n", options.auton, ez::as::auton_selector.auton_count);
+      std::_Exit(2);
+    }
+    ez::as::auton_selector.auton_page_current = options.auton - 1;
+    ez::as::auton_selector.selected_auton_print();
+    finished = sim::period_run(autonomous, "User Autonomous (PROS)", COMPETITION_AUTONOMOUS | COMPETITION_CONNECTED, options.time);
+  }
+
+  std::uint32_t elapsed = pros::millis() - start;
+  double host = sim::Kernel::get().host_seconds();
+  std::printf("sim: %s %s after %lu ms (%.2f s on the host, %.0fx real time)\n", options.opcontrol ? "opcontrol" : options.autotune ? "autotune" : "autonomous",
+              finished ? "finished" : "timed out", (unsigned long)elapsed, host, host > 0 ? pros::millis() / 1000.0 / host : 0.0);
+  const DriveModel::State& pose = drive.model.state;
+  std::printf("sim: robot ended at x %.1f in, y %.1f in, heading %.1f deg\n", pose.x / 0.0254, pose.y / 0.0254, -pose.theta * 180.0 / M_PI);
+  if (options.opcontrol)
+    std::printf("sim: the command buffer wrote %lu outputs and skipped %lu unchanged ones\n", (unsigned long)commands.writes_get(), (unsigned long)commands.skipped_get());
+  if (options.replay) std::printf("sim: replayed %zu of %zu controller frames\n", replay_next, replay_records.size());
+  timeline.print();
+  if (options.profile) profiler.print();
+  ez::pose odom = chassis.odom_pose_get();
+  std::printf("sim: odometry has it at x %.1f in, y %.1f in, heading %.1f deg\n", odom.y, -odom.x, odom.theta);
+  std::fflush(stdout);
+
+  // Every other task is parked on the kernel, so don't wait for them to unwind
+  std::_Exit(0);
+}
@@ -0,0 +1,85 @@
+// Checks ControlScheduler against a virtual clock, no PROS kernel involved:
+//
+//   sched_check
+//
+// Callbacks advance the clock by however long they're meant to take, and delay_until jumps it
+// to the wake time, so every period and overrun is exact.  Exits non zero if a check fails.
+
+#include <cstdio>
+
+#include "scheduler.hpp"
+
+namespace {
+std::uint64_t now_us = 0;
+int failures = 0;
+
+std::uint32_t virtual_millis() { return now_us / 1000; }
+std::uint64_t virtual_micros() { return now_us; }
+void virtual_delay_until(std::uint32_t* prev_time, std::uint32_t delta) {
+  *prev_time += delta;
+  if ((std::uint64_t)*prev_time * 1000 > now_us) now_us = (std::uint64_t)*prev_time * 1000;
+}
+
+const SchedulerClock VIRTUAL_CLOCK = {virtual_millis, virtual_micros, virtual_delay_until};
+
+void check(bool ok, const char* what, unsigned long got, unsigned long expected) {
+  std::printf("%s %s (got %lu, expected %lu)\n", ok ? "pass" : "FAIL", what, got, expected);
+  if (!ok) failures++;
+}
+
+void check_equal(const char* what, unsigned long got, unsigned long expected) { check(got == expected, what, got, expected); }
+
+// Runs n ticks the way run() does, without the loop that never returns
+void ticks_run(ControlScheduler& scheduler, int n) {
+  for (int i = 0; i < n; i++) {
+    scheduler.tick();
+    scheduler.wait();
+  }
+}
+
+// Callbacks that take a little time run at exactly the tick, and ones with a period at a multiple of it
+void period_check() {
+  now_us = 0;
+  ControlScheduler scheduler(10, VIRTUAL_CLOCK);
+  int every = scheduler.add("every", [] { now_us += 1500; });
+  int slow = scheduler.add("slow", [] { now_us += 500; }, 30);
+  ticks_run(scheduler, 99);
+
+  check_equal("every tick runs", scheduler.stats_get(every).runs, 99);
+  check_equal("every tick period us", scheduler.stats_get(every).period_max, 10000);
+  check_equal("every tick exec us", scheduler.stats_get(every).exec_max, 1500);
+  check_equal("30ms callback runs", scheduler.stats_get(slow).runs, 33);
+  check_equal("30ms callback period us", scheduler.stats_get(slow).period_max, 30000);
+  check_equal("no overruns", scheduler.stats_get(every).overruns + scheduler.stats_get(slow).overruns, 0);
+  check_equal("no late ticks", scheduler.late_ticks_get(), 0);
+  check_equal("99 ticks take 990ms", virtual_millis(), 990);
+}
+
+// One tick that runs 25ms long counts one overrun and one late tick, then the schedule starts over
+// from where it ended instead of running the missed ticks back to back
+void overrun_check() {
+  now_us = 0;
+  int tick = 0;
+  ControlScheduler scheduler(10, VIRTUAL_CLOCK);
+  int id = scheduler.add("stall", [&tick] { now_us += ++tick == 5 ? 25000 : 1000; });
+  ticks_run(scheduler, 5);
+  std::uint32_t stalled_at = virtual_millis();
+  ticks_run(scheduler, 5);
+
+  ControlScheduler::Stats stats = scheduler.stats_get(id);
+  check_equal("overruns", stats.overruns, 1);
+  check_equal("late ticks", scheduler.late_ticks_get(), 1);
+  // Tick 5 starts at 40ms and ends at 65ms, the next one is a full tick after that
+  check_equal("resynced after the stall at ms", stalled_at, 75);
+  check_equal("period after the stall us", stats.period, 10000);
+  check_equal("stall period us", stats.period_max, 35000);
+  check_equal("5 more ticks end at ms", virtual_millis(), 125);
+}
+}  // namespace
+
+int main() {
+  period_check();
+  overrun_check();
+  std::printf("%s\n", failures ? "sched_check: FAILED" : "sched_check: all passed");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,52 @@
+#include "sim/tank_plant.hpp"
+
+#include <cmath>
+
+namespace sim {
+
+TankPlant::TankPlant(std::vector<int> left_ports, std::vector<int> right_ports, DriveModel::Params params) : model(params) {
+  left.ports = left_ports;
+  right.ports = right_ports;
+  for (auto port : left_ports) devices().motors[port_index(port)].driven = true;
+  for (auto port : right_ports) devices().motors[port_index(port)].driven = true;
+}
+
+// Average voltage towards driving forward
+void TankPlant::side_read(Side& side) {
+  side.volts = 0;
+  side.coast = true;
+  for (auto port : side.ports) {
+    Motor& m = devices().motors[port_index(port)];
+    side.volts += (port < 0 ? -1 : 1) * m.volts();
+    if (m.brake_mode != 0) side.coast = false;
+  }
+  side.volts /= side.ports.size();
+}
+
+void TankPlant::side_write(Side& side, double wheel_velocity, double current, double dt) {
+  for (auto port : side.ports) {
+    Motor& m = devices().motors[port_index(port)];
+    double sign = port < 0 ? -1 : 1;
+    m.velocity = sign * model.motor_rpm(wheel_velocity);
+    m.position += m.velocity / 60.0 * 360.0 * dt;
+    m.current = std::fabs(current) * 1000.0;
+  }
+}
+
+void TankPlant::step(double dt) {
+  side_read(left);
+  side_read(right);
+  model.step(left.volts, right.volts, dt, left.coast, right.coast);
+
+  side_write(left, model.left_wheel_velocity(), model.state.left_current, dt);
+  side_write(right, model.right_wheel_velocity(), model.state.right_current, dt);
+
+  // IMUs are clockwise positive, the model is counter clockwise
+  for (auto& imu : devices().imus) {
+    imu.rotation = -model.state.theta * 180.0 / M_PI;
+    imu.rate = -model.state.angular_velocity * 180.0 / M_PI;
+  }
+  devices().battery_mv = model.state.battery_volts * 1000.0;
+}
+
+}  // namespace sim
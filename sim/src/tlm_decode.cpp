@@ -0,0 +1,123 @@
+// Decodes the robot's serial telemetry (Telemetry::serial_enable()) into CSV:
+//
+//   tlm_decode [--raw] [file]
+//
+// Reads the brain's USB serial port (put it in raw mode first, ie. stty -F /dev/ttyACM1 raw) or
+// a capture of it, and stdin without a file.  PROS wraps every stream in its own COBS packets
+// with a 4 byte stream id, only the "eztl" ones are unwrapped, so printf output on sout is
+// skipped.  --raw reads frames that aren't wrapped, ie. with PROS's COBS disabled.
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "telemetry_frame.hpp"
+
+namespace {
+struct Stats {
+  unsigned long frames = 0;
+  unsigned long bad = 0;
+  unsigned long gaps = 0;
+  std::uint16_t next_seq[5] = {};
+  bool seen[5] = {};
+};
+
+const char* source_name(int source) {
+  switch (source) {
+    case Telemetry::DRIVE:
+      return "drive";
+    case Telemetry::CONTROL:
+      return "control";
+    case Telemetry::EXIT:
+      return "exit";
+    case Telemetry::INPUTS:
+      return "inputs";
+    default:
+      return "unknown";
+  }
+}
+
+void frame_print(const std::uint8_t* frame, std::size_t size, Stats& stats) {
+  if (size == 0) return;
+  Telemetry::Record r;
+  if (!telemetry_frame_decode(frame, size, r) || r.source < 1 || r.source > Telemetry::INPUTS) {
+    stats.bad++;
+    return;
+  }
+  stats.frames++;
+  if (stats.seen[r.source] && r.seq != stats.next_seq[r.source]) stats.gaps++;
+  stats.seen[r.source] = true;
+  stats.next_seq[r.source] = r.seq + 1;
+
+  std::printf("%lu,%s,%u,%u", (unsigned long)r.time, source_name(r.source), r.mode, r.seq);
+  for (float value : r.values) std::printf(",%g", value);
+  std::printf("\n");
+}
+
+// Splits a byte stream on 0 delimiters and hands each piece to on_packet
+template <typename F>
+class Splitter {
+ public:
+  explicit Splitter(F on_packet) : on_packet(on_packet) {}
+
+  void push(const std::uint8_t* data, std::size_t size) {
+    for (std::size_t i = 0; i < size; i++) {
+      if (data[i] == 0) {
+        on_packet(packet.data(), packet.size());
+        packet.clear();
+      } else {
+        packet.push_back(data[i]);
+      }
+    }
+  }
+
+ private:
+  F on_packet;
+  std::vector<std::uint8_t> packet;
+};
+}  // namespace
+
+int main(int argc, char** argv) {
+  bool raw = false;
+  const char* path = nullptr;
+  for (int i = 1; i < argc; i++) {
+    if (!std::strcmp(argv[i], "--raw")) {
+      raw = true;
+    } else if (argv[i][0] != '-' && !path) {
+      path = argv[i];
+    } else {
+      std::printf("usage: %s [--raw] [file]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  FILE* input = path ? std::fopen(path, "rb") : stdin;
+  if (!input) {
+    std::perror(path);
+    return 1;
+  }
+
+  Stats stats;
+  auto frames = Splitter([&](const std::uint8_t* frame, std::size_t size) { frame_print(frame, size, stats); });
+
+  // PROS packet: COBS of [stream id][data].  The data of consecutive "eztl" packets is our stream
+  std::vector<std::uint8_t> unwrapped;
+  auto packets = Splitter([&](const std::uint8_t* packet, std::size_t size) {
+    unwrapped.resize(size);
+    std::size_t decoded = cobs_decode(packet, size, unwrapped.data());
+    if (decoded > 4 && !std::memcmp(unwrapped.data(), "eztl", 4)) frames.push(unwrapped.data() + 4, decoded - 4);
+  });
+
+  std::printf("time,source,mode,seq,v0,v1,v2,v3,v4,v5,v6,v7\n");
+  std::uint8_t buffer[4096];
+  while (std::size_t size = std::fread(buffer, 1, sizeof(buffer), input)) {
+    if (raw)
+      frames.push(buffer, size);
+    else
+      packets.push(buffer, size);
+    std::fflush(stdout);
+  }
+
+  std::fprintf(stderr, "tlm_decode: %lu frames, %lu bad, %lu gaps in seq\n", stats.frames, stats.bad, stats.gaps);
+  return 0;
+}
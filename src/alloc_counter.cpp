@@ -0,0 +1,26 @@
+#include "alloc_counter.hpp"
+
+#ifdef DEBUG_ALLOC_COUNT
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<std::uint32_t> alloc_count{0};
+
+std::uint32_t alloc_count_get() { return alloc_count.load(std::memory_order_relaxed); }
+
+void* operator new(std::size_t size) {
+  alloc_count.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) { return operator new(size); }
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+#else
+std::uint32_t alloc_count_get() { return 0; }
+#endif
@@ -120,6 +120,42 @@ void wait_until_change_speed() {
   chassis.pid_wait();
 }
 
+///
+// Milestone Actions Example
+///
+void actions_example() {
+  // Actions run a mechanism partway through a motion instead of stopping the robot for it.  Add
+  // them right after the motion they belong to, each one runs once and must not block
+
+  setIntake(100);
+  chassis.pid_drive_set(36_in, DRIVE_SPEED, true);
+  chassis.pid_action_distance_add(24_in, [] { setIntake(0); });  // 24 inches in
+  chassis.pid_wait();
+
+  chassis.pid_turn_set(90_deg, TURN_SPEED);
+  chassis.pid_action_angle_add(30_deg, [] { wingControl(true); });  // 30 degrees into the turn
+  chassis.pid_action_progress_add(0.9, [] { setIntake(-100); });    // 90% of the way to 90
+  chassis.pid_wait();
+
+  chassis.pid_drive_set(-12_in, DRIVE_SPEED);
+  chassis.pid_action_progress_add(0.5, [] { wingControl(false); setIntake(0); });
+  chassis.pid_wait();
+}
+
+///
+// Profiled Drive Example
+///
+void profiled_drive_example() {
+  // Profiled drives slow down on their own before the target, so they can run at full speed
+  // without blowing through it.  The exit conditions are checked once the profile is done
+
+  chassis.pid_drive_profiled_set(48_in, 127);
+  chassis.pid_wait();
+
+  chassis.pid_drive_profiled_set(-48_in, 127);
+  chassis.pid_wait();
+}
+
 ///
 // Swing Example
 ///
@@ -162,6 +198,55 @@ void combining_movements() {
   chassis.pid_wait();
 }
 
+///
+// Odometry Example
+///
+void odom_example() {
+  // Targets are field positions from where autonomous() zeroed odometry, so each motion
+  // corrects whatever error the last one ended with.  x is right, y is forward, in inches
+
+  chassis.pid_drive_to_point(0, 24, DRIVE_SPEED, true);
+  chassis.pid_wait();
+
+  chassis.pid_turn_to_point(24, 24, TURN_SPEED);
+  chassis.pid_wait();
+
+  // Arrives at (24, 48) facing 0 degrees, curving in from below
+  chassis.pid_drive_to_pose({24, 48, 0}, DRIVE_SPEED);
+  chassis.pid_wait();
+
+  // Behind the robot, so this backs up
+  chassis.pid_drive_to_point(0, 0, DRIVE_SPEED);
+  chassis.pid_wait();
+}
+
+///
+// Path Example
+///
+void path_example() {
+  // Paths are generated at build time from include/path_specs.hpp, so these start right away.
+  // Each starts where the last ends, at the pose autonomous() zeroed odometry to
+
+  chassis.pid_path_set(path_example_curve, DRIVE_SPEED, true);
+  chassis.pid_wait();
+
+  chassis.pid_path_set(path_example_return, DRIVE_SPEED, true);
+  chassis.pid_wait();
+}
+
+///
+// Autotune Example
+///
+void autotune_example() {
+  // Each autotune turns or drives there and back on the current constants, works new ones out
+  // of a relay test, then does it again on them.  The report goes to the terminal and the brain,
+  // and the new constants are only kept for the rest of the program, copy them into
+  // default_constants() if they're better
+
+  chassis.pid_turn_autotune(90, TURN_SPEED);
+  chassis.pid_drive_autotune(24, DRIVE_SPEED);
+}
+
 ///
 // Interference example
 ///
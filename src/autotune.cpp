@@ -0,0 +1,214 @@
+#include <cmath>
+
+#include "main.h"
+
+using namespace ez;
+
+namespace {
+// Relay cycles to let die out before measuring, then how many to average
+constexpr int RELAY_SETTLE_CYCLES = 2;
+constexpr int RELAY_CYCLES = 4;
+constexpr std::uint32_t RELAY_TIMEOUT = 5000;
+
+// A step has settled once it's stayed inside the exit window this long
+constexpr std::uint32_t SETTLE_HOLD = 300;
+constexpr std::uint32_t STEP_TIMEOUT = 4000;
+
+// What the autotuner needs from turning or driving, turns read the IMU and drives the encoders
+struct TuneAxis {
+  const char* name;
+  const char* unit;
+  double hysteresis;  // the relay switches this far either side of where it started
+  double band;        // the exit window, a step has settled inside it
+  double (*position)(Drive&);
+  void (*relay)(Drive&, int output);
+  void (*move)(Drive&, double target, int speed);  // relative to where the robot is
+  PID::Constants (*constants_get)(Drive&);
+  void (*constants_set)(Drive&, PID::Constants);
+  void (*schedule_toggle)(Drive&, bool);
+};
+
+struct StepResponse {
+  int settle;  // ms
+  double overshoot;
+};
+}  // namespace
+
+// Moves target, holds there until it's settled, and measures how it got there
+static StepResponse step_measure(Drive& drive, const TuneAxis& axis, double target, int speed) {
+  double goal = axis.position(drive) + target;
+  double sign = util::sgn(target);
+  StepResponse response = {0, 0.0};
+  axis.move(drive, target, speed);
+
+  std::uint32_t start = pros::millis();
+  std::uint32_t elapsed = 0;
+  while (elapsed < STEP_TIMEOUT) {
+    pros::delay(util::DELAY_TIME);
+    elapsed = pros::millis() - start;
+    // Positive is short of the target
+    double error = (goal - axis.position(drive)) * sign;
+    if (-error > response.overshoot) response.overshoot = -error;
+    if (fabs(error) > axis.band) response.settle = elapsed;
+    if (elapsed - response.settle >= SETTLE_HOLD) break;
+  }
+  if (elapsed >= STEP_TIMEOUT) response.settle = STEP_TIMEOUT;
+  return response;
+}
+
+// There and back, settle times add and the worst overshoot counts
+static StepResponse steps_measure(Drive& drive, const TuneAxis& axis, double target, int speed) {
+  StepResponse there = step_measure(drive, axis, target, speed);
+  StepResponse back = step_measure(drive, axis, -target, speed);
+  return {there.settle + back.settle, fmax(there.overshoot, back.overshoot)};
+}
+
+// Bangs the output between +relay and -relay around where the robot is.  The oscillation that
+// builds up crosses -180 degrees of phase, its period is Tu and its amplitude gives Ku
+static bool relay_identify(Drive& drive, const TuneAxis& axis, int relay, double& ku, int& tu) {
+  double center = axis.position(drive);
+  double h = axis.hysteresis;
+  int direction = 1;
+  int rises = 0;
+  int measured = 0;
+  double high = -INFINITY;
+  double low = INFINITY;
+  double period_sum = 0;
+  double amplitude_sum = 0;
+  std::uint32_t last_rise = 0;
+
+  std::uint32_t start = pros::millis();
+  while (measured < RELAY_CYCLES && pros::millis() - start < RELAY_TIMEOUT) {
+    double error = axis.position(drive) - center;
+    high = fmax(high, error);
+    low = fmin(low, error);
+    if (direction > 0 && error > h) {
+      direction = -1;
+    } else if (direction < 0 && error < -h) {
+      // Switching back up ends a cycle, which holds one peak and one trough
+      direction = 1;
+      std::uint32_t now = pros::millis();
+      if (rises >= RELAY_SETTLE_CYCLES) {
+        period_sum += now - last_rise;
+        amplitude_sum += (high - low) / 2.0;
+        measured++;
+      }
+      rises++;
+      last_rise = now;
+      high = -INFINITY;
+      low = INFINITY;
+    }
+    axis.relay(drive, direction * relay);
+    pros::delay(util::DELAY_TIME);
+  }
+  axis.relay(drive, 0);
+  if (measured == 0) return false;
+
+  double amplitude = amplitude_sum / measured;
+  if (amplitude <= h) return false;
+  tu = lround(period_sum / measured);
+  // The relay's describing function, with hysteresis
+  ku = 4.0 * relay / (M_PI * sqrt(amplitude * amplitude - h * h));
+  return true;
+}
+
+// Ziegler-Nichols' no overshoot rule.  ez::PID works in 10ms ticks, its integral is a sum of
+// errors and its derivative a difference, so kI is kP / Ti * 0.01 and kD is kP * Td / 0.01.
+// The integral only runs inside start_i, so it pushes through friction at the end of a motion
+// without winding up on the way there
+static PID::Constants gains_compute(double ku, int tu, double band) {
+  double dt = util::DELAY_TIME / 1000.0;
+  double kp = 0.2 * ku;
+  double ti = tu / 1000.0 / 2.0;
+  double td = tu / 1000.0 / 3.0;
+  return {kp, kp / ti * dt, kp * td / dt, 2.0 * band};
+}
+
+static void autotune_print(const TuneAxis& axis, const autotune_result& result) {
+  printf("\n%s autotune: Ku %.3f per %s, Tu %d ms\n", axis.name, result.ultimate_gain, axis.unit, result.ultimate_period);
+  printf("          kP       kI       kD       start_i  settle    overshoot\n");
+  const char* row = "  %s  %-8.3f %-8.4f %-8.3f %-8.2f %4d ms   %.2f %s\n";
+  printf(row, "before", result.before.kp, result.before.ki, result.before.kd, result.before.start_i, result.settle_before, result.overshoot_before, axis.unit);
+  if (result.ultimate_gain > 0)
+    printf(row, "after ", result.after.kp, result.after.ki, result.after.kd, result.after.start_i, result.settle_after, result.overshoot_after, axis.unit);
+  printf("  %s\n", result.kept ? "Kept the new constants" : "Kept the old constants");
+
+  char text[128];
+  snprintf(text, sizeof(text), "%s autotune %s\nbefore P %.2f D %.2f\n %d ms, %.2f %s\nafter P %.2f D %.2f\n %d ms, %.2f %s", axis.name,
+           result.kept ? "kept" : "not kept", result.before.kp, result.before.kd, result.settle_before, result.overshoot_before, axis.unit,
+           result.after.kp, result.after.kd, result.settle_after, result.overshoot_after, axis.unit);
+  ez::screen_print(text, 1);
+}
+
+static autotune_result autotune_run(Drive& drive, const TuneAxis& axis, double target, int speed, int relay) {
+  autotune_result result = {};
+  result.before = axis.constants_get(drive);
+  result.after = result.before;
+  relay = abs(util::clamp(relay, 127, -127));
+
+  StepResponse before = steps_measure(drive, axis, target, speed);
+  result.settle_before = before.settle;
+  result.overshoot_before = before.overshoot;
+
+  if (!relay_identify(drive, axis, relay, result.ultimate_gain, result.ultimate_period)) {
+    printf("%s autotune: the relay test didn't oscillate, try a bigger relay output\n", axis.name);
+    result.ultimate_gain = 0;
+    autotune_print(axis, result);
+    return result;
+  }
+  result.after = gains_compute(result.ultimate_gain, result.ultimate_period, axis.band);
+
+  axis.schedule_toggle(drive, false);
+  axis.constants_set(drive, result.after);
+  StepResponse after = steps_measure(drive, axis, target, speed);
+  result.settle_after = after.settle;
+  result.overshoot_after = after.overshoot;
+
+  // Overshoot that stays inside half the exit window doesn't count against the new constants
+  result.kept = result.settle_after < result.settle_before && result.overshoot_after <= fmax(result.overshoot_before, axis.band / 2.0);
+  if (!result.kept) {
+    axis.constants_set(drive, result.before);
+    axis.schedule_toggle(drive, true);
+  }
+  autotune_print(axis, result);
+  return result;
+}
+
+autotune_result Drive::pid_turn_autotune(double target, int speed, int relay) {
+  TuneAxis axis = {
+      "Turn",
+      "deg",
+      1.0,
+      turnPID.exit.small_error,
+      [](Drive& d) { return d.drive_imu_get(); },
+      [](Drive& d, int output) { d.drive_set(output, -output); },
+      [](Drive& d, double target, int speed) { d.pid_turn_relative_set(target, speed); },
+      [](Drive& d) { return d.pid_turn_constants_get(); },
+      [](Drive& d, PID::Constants c) { d.pid_turn_constants_set(c.kp, c.ki, c.kd, c.start_i); },
+      [](Drive& d, bool enabled) { d.turnPID.gains_schedule_toggle(enabled); },
+  };
+  return autotune_run(*this, axis, target, speed, relay);
+}
+
+autotune_result Drive::pid_drive_autotune(double target, int speed, int relay) {
+  // Backward constants go back the way they were if the new ones aren't kept
+  PID::Constants backward = pid_drive_constants_backward_get();
+  TuneAxis axis = {
+      "Drive",
+      "in",
+      0.25,
+      leftPID.exit.small_error,
+      [](Drive& d) { return (d.drive_sensor_left() + d.drive_sensor_right()) / 2.0; },
+      [](Drive& d, int output) { d.drive_set(output, output); },
+      [](Drive& d, double target, int speed) { d.pid_drive_set(target, speed); },
+      [](Drive& d) { return d.pid_drive_constants_forward_get(); },
+      [](Drive& d, PID::Constants c) { d.pid_drive_constants_set(c.kp, c.ki, c.kd, c.start_i); },
+      [](Drive& d, bool enabled) {
+        d.leftPID.gains_schedule_toggle(enabled);
+        d.rightPID.gains_schedule_toggle(enabled);
+      },
+  };
+  autotune_result result = autotune_run(*this, axis, target, speed, relay);
+  if (!result.kept) pid_drive_constants_backward_set(backward.kp, backward.ki, backward.kd, backward.start_i);
+  return result;
+}
@@ -0,0 +1,47 @@
+#include "climb.hpp"
+
+#include "main.h"
+
+ClimbHold climbHold;
+
+void ClimbHold::initialize() {
+  auto consts = chassis.turnPID.constants_get();
+  pid.constants_set(consts.kp, consts.ki, consts.kd, consts.start_i);
+  pid.exit_condition_set(80, 50, 300, 150, 500, 500);
+  exec = 0;
+  exec_max = 0;
+}
+
+void ClimbHold::step() {
+  std::uint64_t start = pros::c::micros();
+
+  double heading = sensors.latest().heading;
+  pid.target_set(heading > 180 ? 180 : 0);
+  output = pid.compute(heading);
+
+  if (!lock) {
+    output = 0.0;
+  }
+
+  const ControllerFrame& input = inputs.latest();
+  commands.drive_set(input.analog_get(pros::E_CONTROLLER_ANALOG_LEFT_Y) + output, input.analog_get(pros::E_CONTROLLER_ANALOG_RIGHT_Y) - output);
+
+  exec = pros::c::micros() - start;
+  exec_max = std::max(exec, exec_max);
+}
+
+void ClimbHold::lock_set(bool input) { lock = input; }
+
+bool ClimbHold::lock_get() { return lock; }
+
+void ClimbHold::button_toggle(int toggle) {
+  if (inputs.latest().new_press((pros::controller_digital_e_t)toggle)) {
+    lock = !lock;
+  }
+}
+
+double ClimbHold::output_get() { return output; }
+
+std::uint32_t ClimbHold::exec_get() { return exec; }
+
+std::uint32_t ClimbHold::exec_max_get() { return exec_max; }
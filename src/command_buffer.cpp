@@ -0,0 +1,115 @@
+#include "command_buffer.hpp"
+
+#include <mutex>
+
+#include "main.h"
+
+CommandBuffer commands;
+
+CommandBuffer::MotorSlot* CommandBuffer::motor_slot(const pros::Motor& motor) {
+  for (int i = 0; i < motor_count; i++) {
+    if (motors[i].motor == &motor) return &motors[i];
+  }
+  if (motor_count == MAX_MOTORS) {
+    printf("Too many motors in the command buffer (%d), ignoring this one\n", MAX_MOTORS);
+    return nullptr;
+  }
+  motors_stale |= 1u << motor_count;
+  motors[motor_count] = {&motor, 0, 0};
+  return &motors[motor_count++];
+}
+
+void CommandBuffer::voltage_set(const pros::Motor& motor, int voltage) {
+  MotorSlot* slot = motor_slot(motor);
+  if (!slot) return;
+  slot->voltage = util::clamp(voltage, 12000, -12000);
+  motors_dropped &= ~(1u << (slot - motors));
+}
+
+void CommandBuffer::motor_set(const pros::Motor& motor, int voltage) {
+  std::lock_guard<pros::Mutex> lock(mutex);
+  voltage_set(motor, voltage);
+}
+
+void CommandBuffer::digital_set(const pros::ADIDigitalOut& output, bool value) {
+  std::lock_guard<pros::Mutex> lock(mutex);
+  for (int i = 0; i < digital_count; i++) {
+    if (digitals[i].output == &output) {
+      digitals[i].value = value;
+      digitals_dropped &= ~(1u << i);
+      return;
+    }
+  }
+  if (digital_count == MAX_DIGITALS) {
+    printf("Too many pneumatics in the command buffer (%d), ignoring this one\n", MAX_DIGITALS);
+    return;
+  }
+  digitals_stale |= 1u << digital_count;
+  digitals[digital_count++] = {&output, value, false};
+}
+
+void CommandBuffer::drive_set(int left, int right) {
+  std::lock_guard<pros::Mutex> lock(mutex);
+  // A PID motion's drive task wrote these last, so what the buffer thinks they're at is stale
+  if (chassis.drive_mode_get() != ez::DISABLE) {
+    chassis.drive_mode_set(ez::DISABLE);
+    for (auto* side : {&chassis.left_motors, &chassis.right_motors}) {
+      for (auto& motor : *side) {
+        MotorSlot* slot = motor_slot(motor);
+        if (slot) motors_stale |= 1u << (slot - motors);
+      }
+    }
+  }
+  // Same scaling as chassis.drive_set()
+  for (auto& motor : chassis.left_motors)
+    if (!chassis.pto_check(motor)) voltage_set(motor, left * (12000.0 / 127.0));
+  for (auto& motor : chassis.right_motors)
+    if (!chassis.pto_check(motor)) voltage_set(motor, right * (12000.0 / 127.0));
+}
+
+void CommandBuffer::flush() {
+  std::lock_guard<pros::Mutex> lock(mutex);
+  for (int i = 0; i < motor_count; i++) {
+    MotorSlot& slot = motors[i];
+    if (motors_dropped & (1u << i)) continue;
+    if (slot.voltage == slot.written && !(motors_stale & (1u << i))) {
+      skipped++;
+      continue;
+    }
+    slot.motor->move_voltage(slot.voltage);
+    slot.written = slot.voltage;
+    writes++;
+  }
+  for (int i = 0; i < digital_count; i++) {
+    DigitalSlot& slot = digitals[i];
+    if (digitals_dropped & (1u << i)) continue;
+    if (slot.value == slot.written && !(digitals_stale & (1u << i))) {
+      skipped++;
+      continue;
+    }
+    slot.output->set_value(slot.value);
+    slot.written = slot.value;
+    writes++;
+  }
+  // Dropped outputs stay stale until something sets them
+  motors_stale &= motors_dropped;
+  digitals_stale &= digitals_dropped;
+}
+
+void CommandBuffer::invalidate() {
+  std::lock_guard<pros::Mutex> lock(mutex);
+  motors_stale = (1u << motor_count) - 1;
+  digitals_stale = (1u << digital_count) - 1;
+  motors_dropped = motors_stale;
+  digitals_dropped = digitals_stale;
+}
+
+std::uint32_t CommandBuffer::writes_get() { return writes; }
+
+std::uint32_t CommandBuffer::skipped_get() { return skipped; }
+
+void CommandBuffer::stats_reset() {
+  std::lock_guard<pros::Mutex> lock(mutex);
+  writes = 0;
+  skipped = 0;
+}
@@ -0,0 +1,66 @@
+#include "controller_frame.hpp"
+
+#include "main.h"
+
+ControllerFrameService inputs;
+
+void ControllerFrameService::publish(std::uint16_t pressed, const std::int8_t (&analog)[ControllerFrame::ANALOG_COUNT]) {
+  // Write into the buffer readers aren't using, then publish it with one store
+  std::uint32_t front = published.load(std::memory_order_relaxed);
+  std::uint16_t last = frames[front].pressed;
+  ControllerFrame& frame = frames[(front + 1) & 1];
+
+  frame.time = pros::millis();
+  frame.pressed = pressed;
+  frame.rising = pressed & ~last;
+  frame.falling = last & ~pressed;
+  for (int i = 0; i < ControllerFrame::ANALOG_COUNT; i++) frame.analog[i] = analog[i];
+
+  frame.seq = ++seq;
+  published.store((front + 1) & 1, std::memory_order_release);
+}
+
+void ControllerFrameService::update() {
+  if (replay_source) {
+    std::uint16_t pressed;
+    std::int8_t analog[ControllerFrame::ANALOG_COUNT];
+    if (replay_source(pressed, analog)) {
+      replay(pressed, analog);
+      return;
+    }
+    replay_source = nullptr;
+  }
+
+  std::uint16_t pressed = 0;
+  for (int button = pros::E_CONTROLLER_DIGITAL_L1; button <= pros::E_CONTROLLER_DIGITAL_A; button++) {
+    std::uint16_t bit = ControllerFrame::bit((pros::controller_digital_e_t)button);
+    if ((buttons & bit) && master.get_digital((pros::controller_digital_e_t)button) == 1) pressed |= bit;
+  }
+
+  std::int8_t analog[ControllerFrame::ANALOG_COUNT];
+  for (int i = 0; i < ControllerFrame::ANALOG_COUNT; i++) {
+    // PROS_ERR when the controller drops out, that's the stick at rest
+    std::int32_t value = master.get_analog((pros::controller_analog_e_t)i);
+    analog[i] = value == PROS_ERR ? 0 : util::clamp(value, 127, -127);
+  }
+  publish(pressed, analog);
+}
+
+void ControllerFrameService::replay(std::uint16_t pressed, const std::int8_t (&analog)[ControllerFrame::ANALOG_COUNT]) { publish(pressed, analog); }
+
+void ControllerFrameService::replay_set(bool (*source)(std::uint16_t& pressed, std::int8_t (&analog)[ControllerFrame::ANALOG_COUNT])) {
+  replay_source = source;
+}
+
+void ControllerFrameService::buttons_set(std::uint16_t mask) { buttons = mask; }
+
+ControllerFrame ControllerFrameService::get() {
+  // If update() lands mid copy the buffer changes under us, so check the seq and retry
+  ControllerFrame copy;
+  do {
+    copy = frames[published.load(std::memory_order_acquire)];
+  } while (copy.seq != frames[published.load(std::memory_order_acquire)].seq);
+  return copy;
+}
+
+const ControllerFrame& ControllerFrameService::latest() { return frames[published.load(std::memory_order_acquire)]; }
@@ -0,0 +1,9 @@
+#include "crc16.hpp"
+
+std::uint16_t crc16(const std::uint8_t* data, std::size_t size, std::uint16_t crc) {
+  for (std::size_t i = 0; i < size; i++) {
+    crc ^= (std::uint16_t)data[i] << 8;
+    for (int bit = 0; bit < 8; bit++) crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+  }
+  return crc;
+}
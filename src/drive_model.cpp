@@ -0,0 +1,109 @@
+#include "drive_model.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+static constexpr double GRAVITY = 9.81;
+
+// Most a side can push before the wheels slip
+static constexpr double TRACTION = 1.1;
+
+// Takes friction out of a velocity without letting it change sign, so a stopped robot stays stopped
+static double friction_apply(double velocity, double loss) {
+  if (std::fabs(velocity) <= loss) return 0;
+  return velocity - std::copysign(loss, velocity);
+}
+
+DriveModel::DriveModel() { reset(); }
+
+DriveModel::DriveModel(Params p_params) : params(p_params) { reset(); }
+
+void DriveModel::precompute() {
+  double free_speed = params.free_rpm * 2.0 * M_PI / 60.0;
+  double torque_per_amp = params.stall_torque / params.stall_current;
+  wheel_radius = params.wheel_diameter / 2.0;
+  back_emf = params.max_volts / free_speed * params.ratio;
+  resistance = params.max_volts / params.stall_current;
+  force_per_amp = torque_per_amp * params.ratio * params.efficiency / wheel_radius;
+  inverse_radius = 1.0 / wheel_radius;
+  inverse_resistance = 1.0 / resistance;
+  inverse_mass = 1.0 / params.mass;
+  inverse_inertia = 1.0 / params.inertia;
+}
+
+void DriveModel::reset() {
+  precompute();
+  state = State();
+  state.battery_volts = params.battery_volts;
+  heading_set(0);
+}
+
+void DriveModel::heading_set(double theta) {
+  state.theta = theta;
+  heading_cos = std::cos(theta);
+  heading_sin = std::sin(theta);
+  steps_since_normalize = 0;
+}
+
+double DriveModel::left_wheel_velocity() const { return (state.velocity - state.angular_velocity * params.track_width / 2.0) * inverse_radius; }
+
+double DriveModel::right_wheel_velocity() const { return (state.velocity + state.angular_velocity * params.track_width / 2.0) * inverse_radius; }
+
+double DriveModel::motor_rpm(double wheel_angular_velocity) const { return wheel_angular_velocity * params.ratio * 60.0 / (2.0 * M_PI); }
+
+double DriveModel::motor_current(double volts, double wheel_angular_velocity, bool coast) const {
+  if (coast) return 0;
+  double current = (volts - back_emf * wheel_angular_velocity) * inverse_resistance;
+  return std::clamp(current, -params.current_limit, params.current_limit);
+}
+
+void DriveModel::step(double left_volts, double right_volts, double dt, bool left_coast, bool right_coast) {
+  // The motors can't put out more than the battery has left
+  double supply = std::min(params.max_volts, state.battery_volts);
+  left_volts = std::clamp(left_volts, -supply, supply);
+  right_volts = std::clamp(right_volts, -supply, supply);
+
+  double left_w = left_wheel_velocity();
+  double right_w = right_wheel_velocity();
+  state.left_current = motor_current(left_volts, left_w, left_coast && left_volts == 0);
+  state.right_current = motor_current(right_volts, right_w, right_coast && right_volts == 0);
+
+  double traction = TRACTION * params.mass * GRAVITY / 2.0;
+  double left_force = std::clamp(params.motors_per_side * force_per_amp * state.left_current, -traction, traction);
+  double right_force = std::clamp(params.motors_per_side * force_per_amp * state.right_current, -traction, traction);
+
+  double force = left_force + right_force - params.viscous * state.velocity;
+  double torque = (right_force - left_force) * params.track_width / 2.0 - params.viscous * state.angular_velocity;
+
+  state.velocity = friction_apply(state.velocity + force * inverse_mass * dt, params.rolling_force * inverse_mass * dt);
+  state.angular_velocity = friction_apply(state.angular_velocity + torque * inverse_inertia * dt, params.scrub_torque * inverse_inertia * dt);
+
+  // Integrate at the midpoint heading.  The heading is kept as a unit vector and rotated by the
+  // small angle each step, which saves a sin and cos per step
+  double turn = state.angular_velocity * dt;
+  double turn_cos = 1.0 - turn * turn / 2.0;
+  double mid_cos = heading_cos - heading_sin * turn / 2.0;
+  double mid_sin = heading_sin + heading_cos * turn / 2.0;
+  state.x += state.velocity * mid_cos * dt;
+  state.y += state.velocity * mid_sin * dt;
+  state.theta += turn;
+  double next_cos = heading_cos * turn_cos - heading_sin * turn;
+  heading_sin = heading_sin * turn_cos + heading_cos * turn;
+  heading_cos = next_cos;
+  if (++steps_since_normalize >= 1000) heading_set(state.theta);
+  state.left_position += left_wheel_velocity() * dt;
+  state.right_position += right_wheel_velocity() * dt;
+
+  // Battery sags with the current drawn through the motor controllers.  This is used next step
+  double battery_current = params.motors_per_side * (std::fabs(state.left_current * left_volts) + std::fabs(state.right_current * right_volts)) / supply;
+  state.battery_volts = params.battery_volts - params.battery_resistance * battery_current;
+}
+
+void DriveModel::linear_to_wheel_vels(double velocity, double curvature, double& left, double& right) const {
+  left = velocity * (1.0 - curvature * params.track_width / 2.0);
+  right = velocity * (1.0 + curvature * params.track_width / 2.0);
+}
+
+double DriveModel::volts_for_speed(double wheel_speed) const { return back_emf * wheel_speed / wheel_radius; }
+
+double DriveModel::free_speed() const { return params.max_volts / back_emf * wheel_radius; }
@@ -0,0 +1,218 @@
+#include <atomic>
+#include <cmath>
+
+#include "main.h"
+
+using namespace ez;
+
+// Profiled drives live here instead of in Drive, firmware/EZ-Template.a was built against
+// Drive's current layout so it can't grow any members
+namespace {
+struct ProfileConstraints {
+  double velocity;      // in/s at a speed of 127
+  double acceleration;  // in/s^2
+  double jerk;          // in/s^3
+};
+
+ProfileConstraints forward_constraints = {62.0, 400.0, 4000.0};
+ProfileConstraints backward_constraints = {62.0, 400.0, 4000.0};
+
+// The running pid_drive_profiled_set().  Written by the caller before active is set, then only
+// by the drive task.  The S-curve is a trapezoid profile averaged over the last smoothing
+// steps, which limits jerk to acceleration / (smoothing * dt) and still ends exactly at distance
+struct DriveProfile {
+  std::atomic<bool> active{false};
+  std::uint32_t start_time;
+  double distance;  // inches, always positive
+  double sign;
+  double velocity;  // trapezoid's peak
+  double acceleration;
+  double accel_time;
+  double cruise_time;
+  int smoothing;
+  double left_start;
+  double right_start;
+  bool heading;
+
+  // With feedforward this writes the motors instead of the drive task, which is off until done
+  bool feedforward;
+  bool drive_toggle;
+
+  // Targets this last wrote, anything else means a new motion replaced it
+  double left_target;
+  double right_target;
+};
+
+DriveProfile profile;
+}  // namespace
+
+// Position along the trapezoid t seconds in
+static double trapezoid_position(double t) {
+  double a = profile.acceleration;
+  double ta = profile.accel_time;
+  double tc = profile.cruise_time;
+  double v = profile.velocity;
+  if (t <= 0) return 0;
+  if (t < ta) return 0.5 * a * t * t;
+  if (t < ta + tc) return 0.5 * a * ta * ta + v * (t - ta);
+  if (t < 2 * ta + tc) {
+    double td = t - ta - tc;
+    return 0.5 * a * ta * ta + v * tc + v * td - 0.5 * a * td * td;
+  }
+  return profile.distance;
+}
+
+static double trapezoid_velocity(double t) {
+  double ta = profile.accel_time;
+  double tc = profile.cruise_time;
+  if (t <= 0 || t >= 2 * ta + tc) return 0;
+  if (t < ta) return profile.acceleration * t;
+  if (t < ta + tc) return profile.velocity;
+  return profile.velocity - profile.acceleration * (t - ta - tc);
+}
+
+// Position along the S-curve t seconds in
+static double profile_position(double t) {
+  double dt = util::DELAY_TIME / 1000.0;
+  double sum = 0;
+  for (int i = 0; i < profile.smoothing; i++) sum += trapezoid_position(t - i * dt);
+  return sum / profile.smoothing;
+}
+
+static double profile_velocity(double t) {
+  double dt = util::DELAY_TIME / 1000.0;
+  double sum = 0;
+  for (int i = 0; i < profile.smoothing; i++) sum += trapezoid_velocity(t - i * dt);
+  return sum / profile.smoothing;
+}
+
+// The average's derivative, what enters the window minus what leaves it
+static double profile_acceleration(double t) {
+  double window = profile.smoothing * util::DELAY_TIME / 1000.0;
+  return (trapezoid_velocity(t) - trapezoid_velocity(t - window)) / window;
+}
+
+static double profile_duration() { return 2 * profile.accel_time + profile.cruise_time + (profile.smoothing - 1) * util::DELAY_TIME / 1000.0; }
+
+// Hands the motors back to the drive task
+static void profile_release(Drive& drive) {
+  if (!profile.feedforward) return;
+  profile.feedforward = false;
+  drive.pid_drive_toggle(profile.drive_toggle);
+}
+
+void Drive::pid_drive_profiled_set(okapi::QLength p_target, int speed, bool toggle_heading) {
+  pid_drive_profiled_set(p_target.convert(okapi::inch), speed, toggle_heading);
+}
+
+void Drive::pid_drive_profiled_set(double target, int speed, bool toggle_heading) {
+  profile.active = false;
+  profile_release(*this);
+
+  // pid_drive_set() hands the drive task the final target, so its output is held off until the
+  // targets are back at the start.  With feedforward it stays off, this writes the motors
+  PID::Feedforward ff = target < 0 ? backward_drivePID.feedforward_get() : forward_drivePID.feedforward_get();
+  leftPID.feedforward_set(ff.kS, ff.kV, ff.kA);
+  rightPID.feedforward_set(ff.kS, ff.kV, ff.kA);
+  profile.drive_toggle = pid_drive_toggle_get();
+  pid_drive_toggle(false);
+  pid_drive_set(target, speed, false, toggle_heading);
+
+  const ProfileConstraints& limits = target < 0 ? backward_constraints : forward_constraints;
+  double top = limits.velocity * abs(util::clamp(speed, 127, -127)) / 127.0;
+  profile.distance = fabs(target);
+  profile.sign = util::sgn(target);
+  profile.acceleration = limits.acceleration;
+  // Too short to reach top speed makes a triangle
+  profile.velocity = fmin(top, sqrt(profile.distance * profile.acceleration));
+  profile.accel_time = profile.velocity > 0 ? profile.velocity / profile.acceleration : 0;
+  profile.cruise_time = profile.velocity > 0 ? (profile.distance - profile.velocity * profile.accel_time) / profile.velocity : 0;
+  profile.smoothing = std::max(1, (int)lround(limits.acceleration / limits.jerk / (util::DELAY_TIME / 1000.0)));
+  profile.left_start = l_start;
+  profile.right_start = r_start;
+  profile.heading = toggle_heading;
+  profile.feedforward = ff.kS != 0 || ff.kV != 0 || ff.kA != 0;
+
+  // Start from where the robot is, the drive task moves the targets from here.  Whatever the
+  // drive task worked out against the final target is dropped so it doesn't kick on the first step
+  profile.left_target = l_start;
+  profile.right_target = r_start;
+  leftPID.target_set(profile.left_target);
+  rightPID.target_set(profile.right_target);
+  for (auto* pid : {&leftPID, &rightPID}) {
+    pid->output = 0;
+    pid->prev_error = 0;
+    pid->integral = 0;
+  }
+  profile.start_time = pros::millis();
+  profile.active = true;
+  if (!profile.feedforward) pid_drive_toggle(profile.drive_toggle);
+}
+
+void Drive::pid_drive_profile_constraints_forward_set(double max_velocity, double max_acceleration, double max_jerk) {
+  forward_constraints = {fabs(max_velocity), fabs(max_acceleration), fabs(max_jerk)};
+}
+
+void Drive::pid_drive_profile_constraints_backward_set(double max_velocity, double max_acceleration, double max_jerk) {
+  backward_constraints = {fabs(max_velocity), fabs(max_acceleration), fabs(max_jerk)};
+}
+
+void Drive::pid_drive_profile_constraints_set(double max_velocity, double max_acceleration, double max_jerk) {
+  pid_drive_profile_constraints_forward_set(max_velocity, max_acceleration, max_jerk);
+  pid_drive_profile_constraints_backward_set(max_velocity, max_acceleration, max_jerk);
+}
+
+void Drive::pid_drive_feedforward_set(double kS, double kV, double kA) {
+  pid_drive_feedforward_forward_set(kS, kV, kA);
+  pid_drive_feedforward_backward_set(kS, kV, kA);
+}
+
+void Drive::pid_drive_feedforward_forward_set(double kS, double kV, double kA) { forward_drivePID.feedforward_set(kS, kV, kA); }
+
+PID::Feedforward Drive::pid_drive_feedforward_forward_get() { return forward_drivePID.feedforward_get(); }
+
+void Drive::pid_drive_feedforward_backward_set(double kS, double kV, double kA) { backward_drivePID.feedforward_set(kS, kV, kA); }
+
+PID::Feedforward Drive::pid_drive_feedforward_backward_get() { return backward_drivePID.feedforward_get(); }
+
+bool Drive::pid_drive_profile_running() { return profile.active; }
+
+bool Drive::pid_drive_profile_final_get(double* targets) {
+  if (!profile.active) return false;
+  targets[0] = profile.left_start + profile.sign * profile.distance;
+  targets[1] = profile.right_start + profile.sign * profile.distance;
+  return true;
+}
+
+void Drive::pid_drive_profile_step() {
+  if (!profile.active) return;
+  if (drive_mode_get() != DRIVE || leftPID.target_get() != profile.left_target || rightPID.target_get() != profile.right_target) {
+    profile.active = false;
+    profile_release(*this);
+    return;
+  }
+
+  double t = (pros::millis() - profile.start_time) / 1000.0;
+  bool done = t >= profile_duration();
+  double traveled = profile.sign * (done ? profile.distance : profile_position(t));
+  profile.left_target = profile.left_start + traveled;
+  profile.right_target = profile.right_start + traveled;
+  leftPID.target_set(profile.left_target);
+  rightPID.target_set(profile.right_target);
+  if (done) {
+    profile.active = false;
+    profile_release(*this);
+    return;
+  }
+
+  if (profile.feedforward) {
+    // The drive task computed the PIDs last tick, this adds feedforward and clips like it would
+    double velocity = profile.sign * profile_velocity(t);
+    double acceleration = profile.sign * profile_acceleration(t);
+    double max = pid_speed_max_get();
+    double left = util::clamp(leftPID.output + leftPID.feedforward_compute(velocity, acceleration), max, -max);
+    double right = util::clamp(rightPID.output + rightPID.feedforward_compute(velocity, acceleration), max, -max);
+    double gyro = profile.heading ? headingPID.output : 0;
+    private_drive_set(left + gyro, right - gyro);
+  }
+}
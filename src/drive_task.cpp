@@ -0,0 +1,39 @@
+#include "main.h"
+
+using namespace ez;
+
+// ez_auto_task() is compiled into firmware/EZ-Template.a, so it can't be changed in place.  The link
+// wraps it (--wrap in the Makefile) and the drive task runs this loop instead.  this is the first argument
+extern "C" void __wrap__ZN2ez5Drive12ez_auto_taskEv(Drive* drive) {
+  TaskProfile* profile = profiler.add("drive", util::DELAY_TIME);
+  while (true) {
+    {
+      TaskProfile::Scope cycle(profile);
+      drive->drive_task_step();
+    }
+    pros::delay(util::DELAY_TIME);
+  }
+}
+
+// The library's loop, with the targets of an odometry motion or a profiled drive moved, the
+// scheduled gains and the thermal speed cap applied first.  They all run here so the PIDs never
+// compute against half of an update
+void Drive::drive_task_step() {
+  pid_pose_step();
+  pid_drive_profile_step();
+  pid_gains_schedule_step();
+  thermal.drive_limit_step();
+
+  // Autonomous PID
+  if (drive_mode_get() == DRIVE)
+    drive_pid_task();
+  else if (drive_mode_get() == TURN)
+    turn_pid_task();
+  else if (drive_mode_get() == SWING)
+    swing_pid_task();
+
+  if (pros::competition::is_autonomous() && !util::AUTON_RAN)
+    util::AUTON_RAN = true;
+  else if (!pros::competition::is_autonomous())
+    drive_mode_set(DISABLE);
+}
@@ -0,0 +1,132 @@
+#include "alloc_counter.hpp"
+#include "main.h"
+#include "motion_trace.hpp"
+
+using namespace ez;
+
+MotionTrace motion_trace;
+
+// exit_to_string() returns a std::string, this doesn't
+static const char* exit_name(exit_output input) {
+  switch (input) {
+    case RUNNING:
+      return "Running";
+    case SMALL_EXIT:
+      return "Small";
+    case BIG_EXIT:
+      return "Big";
+    case VELOCITY_EXIT:
+      return "Velocity";
+    case mA_EXIT:
+      return "mA";
+    case ERROR_NO_CONSTANTS:
+      return "Error: Exit condition constants not set!";
+    default:
+      return "Error: Out of bounds!";
+  }
+}
+
+static bool exit_interfered(exit_output input) { return input == mA_EXIT || input == VELOCITY_EXIT; }
+
+exit_output PID::exit_condition(const pros::Motor* sensors, std::size_t count, bool print) {
+  // If the motors are pulling too many mA, the code will timeout and set interfered to true.
+  if (exit.mA_timeout != 0) {  // Make sure mA_timeout isn't 0
+    is_mA = false;
+    for (std::size_t n = 0; n < count; n++) {
+      // Check if 1 motor is pulling too many mA
+      if (sensors[n].is_over_current()) {
+        is_mA = true;
+        break;
+      }
+    }
+    if (is_mA) {
+      l += util::DELAY_TIME;
+      if (l > exit.mA_timeout) {
+        timers_reset();
+        if (print) exit_condition_print(mA_EXIT);
+        return mA_EXIT;
+      }
+    } else {
+      l = 0;
+    }
+  }
+
+  return exit_condition(print);
+}
+
+// pid_wait() is compiled into firmware/EZ-Template.a, so it can't be changed in place.  The link
+// wraps it (--wrap in the Makefile) and every call lands here instead.  this is the first argument
+extern "C" void __wrap__ZN2ez5Drive8pid_waitEv(Drive* drive) { drive->pid_wait_no_alloc(); }
+
+void Drive::pid_wait_no_alloc() {
+  std::uint32_t allocs = alloc_count_get();
+  // With the serial stream on, exits go out as telemetry frames instead of text
+  bool print = pid_print_toggle_get() && !telemetry.serial_enabled();
+  if (motion_trace.wait_begin) motion_trace.wait_begin();
+  static TaskProfile* const wait_profile = profiler.add("auton", util::DELAY_TIME);
+  if (wait_profile) wait_profile->restart();  // The auton ran something else since the last wait
+
+  pros::delay(util::DELAY_TIME);
+
+  // Drive Exit
+  if (mode == DRIVE) {
+    exit_output left_exit = RUNNING;
+    exit_output right_exit = RUNNING;
+    while (left_exit == RUNNING || right_exit == RUNNING) {
+      {
+        TaskProfile::Scope cycle(wait_profile);
+        // A profiled drive tracks its targets closely the whole way, so it'd pass the small exit
+        // (and the velocity exit, its error barely changes) long before it's there
+        if (!pid_drive_profile_running()) {
+          left_exit = left_exit != RUNNING ? left_exit : leftPID.exit_condition(left_motors.begin(), left_motors.end());
+          right_exit = right_exit != RUNNING ? right_exit : rightPID.exit_condition(right_motors.begin(), right_motors.end());
+        }
+      }
+      pros::delay(util::DELAY_TIME);
+    }
+    if (print) printf("  Left: %s Exit, error: %f.   Right: %s Exit, error: %f.\n", exit_name(left_exit), leftPID.error, exit_name(right_exit), rightPID.error);
+    telemetry.exit_record(DRIVE, left_exit, right_exit, leftPID.error, rightPID.error);
+    if (exit_interfered(left_exit) || exit_interfered(right_exit)) interfered = true;
+    if (motion_trace.wait_end) motion_trace.wait_end(left_exit, right_exit);
+  }
+
+  // Turn Exit
+  else if (mode == TURN) {
+    const std::array<pros::Motor, 2> sensors = {left_motors.front(), right_motors.front()};
+    exit_output turn_exit = RUNNING;
+    while (turn_exit == RUNNING) {
+      {
+        TaskProfile::Scope cycle(wait_profile);
+        turn_exit = turnPID.exit_condition(sensors);
+      }
+      pros::delay(util::DELAY_TIME);
+    }
+    if (print) printf("  Turn: %s Exit, error: %f.\n", exit_name(turn_exit), turnPID.error);
+    telemetry.exit_record(TURN, turn_exit, turn_exit, turnPID.error, turnPID.error);
+    if (exit_interfered(turn_exit)) interfered = true;
+    if (motion_trace.wait_end) motion_trace.wait_end(turn_exit, turn_exit);
+  }
+
+  // Swing Exit
+  else if (mode == SWING) {
+    const pros::Motor& sensor = current_swing == LEFT_SWING ? left_motors.front() : right_motors.front();
+    exit_output swing_exit = RUNNING;
+    while (swing_exit == RUNNING) {
+      {
+        TaskProfile::Scope cycle(wait_profile);
+        swing_exit = swingPID.exit_condition(&sensor, 1);
+      }
+      pros::delay(util::DELAY_TIME);
+    }
+    if (print) printf("  Swing: %s Exit, error: %f.\n", exit_name(swing_exit), swingPID.error);
+    telemetry.exit_record(SWING, swing_exit, swing_exit, swingPID.error, swingPID.error);
+    if (exit_interfered(swing_exit)) interfered = true;
+    if (motion_trace.wait_end) motion_trace.wait_end(swing_exit, swing_exit);
+  }
+
+#ifdef DEBUG_ALLOC_COUNT
+  if (alloc_count_get() != allocs) printf("  pid_wait_no_alloc: %lu allocations!\n", (unsigned long)(alloc_count_get() - allocs));
+#else
+  (void)allocs;
+#endif
+}
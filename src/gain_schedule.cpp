@@ -0,0 +1,34 @@
+#include "main.h"
+
+using namespace ez;
+
+void Drive::pid_turn_gains_schedule_set(PID::ScheduleKey key, std::initializer_list<PID::GainPoint> points) {
+  turnPID.gains_schedule_set(key, points);
+}
+
+void Drive::pid_swing_gains_schedule_set(PID::ScheduleKey key, std::initializer_list<PID::GainPoint> points) {
+  swingPID.gains_schedule_set(key, points);
+}
+
+void Drive::pid_drive_gains_schedule_set(PID::ScheduleKey key, std::initializer_list<PID::GainPoint> points) {
+  leftPID.gains_schedule_set(key, points);
+  rightPID.gains_schedule_set(key, points);
+}
+
+void Drive::pid_gains_schedule_step() {
+  double speed = pid_speed_max_get();
+  switch (drive_mode_get()) {
+    case TURN:
+      turnPID.gains_schedule_update(turnPID.target_get() - drive_imu_get(), speed);
+      break;
+    case SWING:
+      swingPID.gains_schedule_update(swingPID.target_get() - drive_imu_get(), speed);
+      break;
+    case DRIVE:
+      leftPID.gains_schedule_update(leftPID.target_get() - drive_sensor_left(), speed);
+      rightPID.gains_schedule_update(rightPID.target_get() - drive_sensor_right(), speed);
+      break;
+    default:
+      break;
+  }
+}
@@ -0,0 +1,172 @@
+#include <atomic>
+#include <cmath>
+#include <optional>
+
+#include "main.h"
+#include "okapi/api/filter/ekfFilter.hpp"
+
+using namespace ez;
+
+// Heading fusion lives here instead of in Drive, firmware/EZ-Template.a was built against
+// Drive's current layout so it can't grow any members
+namespace {
+// The IMU and the motors each report every 10ms on their own phase, so the filter updates once
+// per new IMU reading with the encoder turn since the last one.  It updates anyway after this
+// many steps without one, a still IMU with no noise reads the same twice
+constexpr int UPDATE_STEPS_MAX = 4;
+
+// An IMU reading further than this from where the encoders put the robot is an impact spike.
+// The readings don't line up in time, so the turn since the last update is allowed on top.
+// Spikes are skipped for up to SPIKE_UPDATES, past that the IMU is believed again
+constexpr double SPIKE_ERROR = 3.0;
+constexpr int SPIKE_UPDATES = 20;
+
+// Scrub is learned over windows of this many updates that turned at least SCRUB_MIN_TURN
+constexpr int SCRUB_WINDOW = 10;
+constexpr double SCRUB_MIN_TURN = 2.0;
+constexpr double SCRUB_RATE = 0.1;
+
+// okapi::EKFFilter with the two things fusion needs that it doesn't have, starting from a
+// heading and stepping without a measurement
+class HeadingFilter : public okapi::EKFFilter {
+ public:
+  using okapi::EKFFilter::EKFFilter;
+
+  void reset(double heading) {
+    xHat = xHatPrev = heading;
+    Pprev = R;
+  }
+
+  void predict(double control) {
+    xHat = xHatPrev = xHatPrev + control;
+    Pprev += Q;
+  }
+};
+
+std::optional<HeadingFilter> heading_filter;
+std::atomic<double> imu_noise{0.2};
+std::atomic<double> encoder_noise{0.08};
+std::atomic<bool> noise_pending{false};
+std::atomic<bool> resync_pending{false};
+std::atomic<double> track_width{11.5};
+
+// Only the odometry task touches these
+double last_imu = 0;
+double encoder_pending = 0;  // encoder turn since the last update, scrub applied
+int update_steps = 0;
+int spike_updates = 0;
+double scrub = 1.0;
+double scrub_covariance = 0;
+double scrub_variance = 0;
+double window_imu = 0;
+double window_encoder = 0;
+int window_updates = 0;
+bool window_spiked = false;
+
+std::atomic<double> fused_heading{0};
+std::atomic<bool> fused_valid{false};
+}  // namespace
+
+double Drive::drive_heading_get() { return fused_valid.load(std::memory_order_acquire) ? fused_heading.load(std::memory_order_relaxed) : drive_imu_get(); }
+
+void Drive::drive_heading_noise_set(double p_imu_noise, double p_encoder_noise) {
+  imu_noise = fmax(fabs(p_imu_noise), 1e-6);
+  encoder_noise = fmax(fabs(p_encoder_noise), 1e-6);
+  noise_pending = true;
+}
+
+void Drive::drive_heading_track_width_set(double width) { track_width = fabs(width); }
+
+void Drive::drive_heading_resync() {
+  // drive_heading_get() is the IMU until the odometry task starts the filter over from it
+  fused_valid.store(false, std::memory_order_relaxed);
+  resync_pending.store(true, std::memory_order_release);
+}
+
+// drive_imu_reset() and drive_angle_set() are compiled into firmware/EZ-Template.a, so the link
+// wraps them (--wrap in the Makefile) to resync the heading after the IMU is set
+extern "C" void __real__ZN2ez5Drive15drive_imu_resetEd(Drive* drive, double new_heading);
+extern "C" void __real__ZN2ez5Drive15drive_angle_setEd(Drive* drive, double angle);
+extern "C" void __real__ZN2ez5Drive15drive_angle_setEN5okapi9RQuantityISt5ratioILl0ELl1EES4_S4_S3_ILl1ELl1EEEE(Drive* drive, okapi::QAngle angle);
+
+extern "C" void __wrap__ZN2ez5Drive15drive_imu_resetEd(Drive* drive, double new_heading) {
+  __real__ZN2ez5Drive15drive_imu_resetEd(drive, new_heading);
+  drive->drive_heading_resync();
+}
+
+extern "C" void __wrap__ZN2ez5Drive15drive_angle_setEd(Drive* drive, double angle) {
+  __real__ZN2ez5Drive15drive_angle_setEd(drive, angle);
+  drive->drive_heading_resync();
+}
+
+extern "C" void __wrap__ZN2ez5Drive15drive_angle_setEN5okapi9RQuantityISt5ratioILl0ELl1EES4_S4_S3_ILl1ELl1EEEE(Drive* drive, okapi::QAngle angle) {
+  __real__ZN2ez5Drive15drive_angle_setEN5okapi9RQuantityISt5ratioILl0ELl1EES4_S4_S3_ILl1ELl1EEEE(drive, angle);
+  drive->drive_heading_resync();
+}
+
+// Least squares fit of IMU turn against encoder turn, averaged over recent windows of turning
+static void scrub_learn(double imu_turn, double encoder_turn, bool spiked) {
+  window_imu += imu_turn;
+  window_encoder += encoder_turn;
+  window_spiked |= spiked;
+  if (++window_updates < SCRUB_WINDOW) return;
+
+  if (!window_spiked && fabs(window_encoder) > SCRUB_MIN_TURN) {
+    scrub_covariance += (window_imu * window_encoder - scrub_covariance) * SCRUB_RATE;
+    scrub_variance += (window_encoder * window_encoder - scrub_variance) * SCRUB_RATE;
+    scrub = util::clamp(scrub_covariance / scrub_variance, 1.3, 0.7);
+  }
+  window_imu = 0;
+  window_encoder = 0;
+  window_updates = 0;
+  window_spiked = false;
+}
+
+bool Drive::drive_heading_step(double left_delta, double right_delta, double imu) {
+  if (!std::isfinite(imu)) return false;
+
+  // A resync starts over from the IMU.  EKFFilter's noise is fixed when it's made, so new noise
+  // makes a new filter where this one was
+  bool resync = resync_pending.exchange(false, std::memory_order_acquire);
+  if (!heading_filter || noise_pending.exchange(false) || resync) {
+    double start = heading_filter && !resync ? heading_filter->getOutput() + encoder_pending : imu;
+    double q = encoder_noise;
+    double r = imu_noise;
+    heading_filter.emplace(q * q, r * r);
+    heading_filter->reset(start);
+    encoder_pending = 0;
+    update_steps = 0;
+    spike_updates = 0;
+    last_imu = imu;
+    fused_heading.store(start, std::memory_order_relaxed);
+    fused_valid.store(true, std::memory_order_release);
+    return resync;
+  }
+
+  // Clockwise positive like the IMU
+  double width = track_width;
+  double encoder_turn = width > 0 ? (left_delta - right_delta) / width * 180.0 / M_PI : 0.0;
+  encoder_pending += encoder_turn * scrub;
+
+  if (imu != last_imu || ++update_steps >= UPDATE_STEPS_MAX) {
+    double control = encoder_pending;
+    double imu_turn = imu - last_imu;
+    double error = imu - (heading_filter->getOutput() + control);
+    bool was_spiked = spike_updates > 0;
+    bool spiked = fabs(error) > SPIKE_ERROR + fabs(control) && spike_updates < SPIKE_UPDATES;
+    if (spiked) {
+      heading_filter->predict(control);
+      spike_updates++;
+    } else {
+      heading_filter->filter(imu, control);
+      spike_updates = 0;
+    }
+    // A spike's in imu_turn on the way in and on the way out
+    scrub_learn(imu_turn, control / scrub, spiked || was_spiked);
+    encoder_pending = 0;
+    update_steps = 0;
+    last_imu = imu;
+  }
+  fused_heading.store(heading_filter->getOutput() + encoder_pending, std::memory_order_relaxed);
+  return false;
+}
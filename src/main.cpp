@@ -47,59 +47,20 @@ ez::Drive chassis (
  * to keep execution time for this mode under a few seconds.
  */
 
-  void manualSetDrive(float Left, float Right){
-      chassis.drive_set(Left, Right);
-  }
-
-      bool climbAngleLock = false;
-
-  ez::PID ClimbPID{};
-
-  
-void climbTask(){
-  pros::delay(2000);
-  auto consts = chassis.turnPID.constants_get();
-  ClimbPID.constants_set(consts.kp, consts.ki, consts.kd, consts.start_i);
-
-  double output = 0.0;
-  while (true) {
-    if (chassis.drive_imu_get() > 180) {
-      ClimbPID.target_set(180);
-    }
-    else {
-      ClimbPID.target_set(0);
-    }
-
-    output = ClimbPID.compute(chassis.drive_imu_get());
-
-    if (!climbAngleLock){
-      output = 0.0;
-    }
-
-    manualSetDrive(master.get_analog(pros::E_CONTROLLER_ANALOG_LEFT_Y) + output, master.get_analog(pros::E_CONTROLLER_ANALOG_RIGHT_Y) - output);
-
-    pros::delay(ez::util::DELAY_TIME);
-  }
-}
-
-pros::Task ClimbTask(climbTask);
-
-
 void initialize() {
+  timeline.phase_begin("initialize");
   //midOFmidOF
   
   
   //Print our branding over your terminal :D
   ez::ez_template_print();
-  ClimbPID.exit_condition_set(80, 50, 300, 150, 500, 500);
   
-  pros::delay(500); // Stop the user from doing anything while legacy ports configure
-
   // Configure your chassis controls
   chassis.opcontrol_curve_buttons_toggle(true); // Enables modifying the controller curve with buttons on the joysticks
   chassis.opcontrol_drive_activebrake_set(0); // Sets the active brake kP. We recommend 0.1.
   chassis.opcontrol_curve_default_set(0, 0); // Defaults for curve. If using tank, only the first parameter is used. (Comment this line out if you have an SD card!)  
   default_constants(); // Set the drive to your own constants from autons.cpp!
+  climbHold.initialize(); // Climb heading hold uses the turn constants, so this has to come after default_constants()
 
   // These are already defaulted to these buttons, but you can change the left/right curve buttons here!
   // chassis.opcontrol_curve_buttons_left_set (pros::E_CONTROLLER_DIGITAL_LEFT, pros::E_CONTROLLER_DIGITAL_RIGHT); // If using tank, only the left side is used. 
@@ -111,10 +72,58 @@ void initialize() {
     Auton("Mid Safe\n\n Descores Ball, Scores Preload, and Touches Bar",riskyOf),
   });
 
-  // Initialize chassis and auton selector
-  chassis.initialize();
-  ez::as::initialize();
+  // The slow parts of chassis.initialize() and ez::as::initialize() run at the same time, autonomous() and opcontrol() wait for them
+  startup.add("imu", [] {
+    timeline.begin("imu calibrate");
+    chassis.drive_imu_calibrate(false); // No loading bar, the selector is coming up on the screen at the same time
+    timeline.end("imu calibrate");
+    chassis.drive_sensor_reset();
+    chassis.odom_enable(true);
+    timeline.mark("odometry started");
+  });
+  int selector = startup.add("selector", ez::as::initialize);
+  startup.add("sd", [] {
+    timeline.begin("curve load");
+    chassis.opcontrol_curve_sd_initialize();
+    timeline.end("curve load");
+    timeline.begin("telemetry open");
+    telemetry.initialize(); // Only records with an SD card
+    timeline.end("telemetry open");
+#ifdef TELEMETRY_SERIAL
+    telemetry.serial_enable(true); // Build with -DTELEMETRY_SERIAL to stream to sim/bin/tlm_decode while tuning
+#endif
+  }, selector); // After the selector, it reads its page off the SD card too
+  startup.add("motors", [] {
+    timeline.begin("legacy ports");
+    pros::delay(500); // Legacy ports take this long to configure
+    timeline.end("legacy ports");
+    subsystemsInitialize();
+    thermal.initialize(); // Predicts when the drive and intake will overheat, see thermal.drive_speed()
+  });
+  startup.start();
+  // profiler.toggle(true); // Loop timing histograms, the center LLEMU button pages through them
+
+  // Teleop callbacks, these run in order every tick of opcontrol
+  scheduler.add("sensors", [] { sensors.update(); }); // Keep this first, everything after reads this frame
+  inputs.buttons_set(ControllerFrame::bit(DIGITAL_R1) | ControllerFrame::bit(DIGITAL_R2) | ControllerFrame::bit(DIGITAL_L1) | ControllerFrame::bit(DIGITAL_L2) |
+                     ControllerFrame::bit(DIGITAL_B) | ControllerFrame::bit(DIGITAL_DOWN) | ControllerFrame::bit(DIGITAL_Y)); // Only the buttons driver control uses
+  scheduler.add("inputs", [] { inputs.update(); }); // Same for the controller
+  scheduler.add("timeline", [] { timeline.tick(); });
+  scheduler.add("climb lock", [] { climbHold.button_toggle(DIGITAL_Y); });
+  scheduler.add("intake", intakeControl);
+  scheduler.add("wings", wingTeleControl);
+  scheduler.add("pto", ptoTeleControl);
+  scheduler.add("climb release", climbReleaseTeleRelease);
+  scheduler.add("scooper", scooperTeleControl);
+  scheduler.add("climb", [] { climbHold.step(); }); // Tank drive + climb heading hold
+  scheduler.add("commands", [] { commands.flush(); }); // Keep this after everything that sets outputs
+  scheduler.add("telemetry", [] {
+    telemetry.control_record();
+    telemetry.input_record();
+  });
+
   master.rumble(".");
+  timeline.mark("initialize returned");
 }
 
 
@@ -125,7 +134,9 @@ void initialize() {
  * the robot is enabled, this task will exit.
  */
 void disabled() {
-  // . . .
+  startup.wait(); // The startup stages belong to the initialize phase, don't save or clear it halfway through them
+  if (!timeline.save()) timeline.print(); // The phase that just ended, before the buffer starts over
+  timeline.phase_begin("disabled");
 }
 
 
@@ -140,7 +151,9 @@ void disabled() {
  * starts.
  */
 void competition_initialize() {
-  // . . .
+  startup.wait(); // Same as disabled(), this usually follows initialize() while the stages are still going
+  if (!timeline.save()) timeline.print();
+  timeline.phase_begin("competition_initialize");
 }
 
 
@@ -157,9 +170,13 @@ void competition_initialize() {
  * from where it left off.
  */
 void autonomous() {
+  startup.wait(); // IMU calibration and the selector have to be done before anything moves, and the timeline's initialize phase ends with them
+  timeline.phase_begin("autonomous");
+  commands.invalidate(); // Nothing opcontrol left in the command buffer carries over
   chassis.pid_targets_reset(); // Resets PID targets to 0
   chassis.drive_imu_reset(); // Reset gyro position to 0
   chassis.drive_sensor_reset(); // Reset drive sensors to 0
+  chassis.odom_pose_set({0, 0, 0}); // Start tracking from here
   chassis.drive_brake_set(pros::E_MOTOR_BRAKE_HOLD); // Set motors to hold.  This helps autonomous consistency
 
   ez::as::auton_selector.selected_auton_call(); // Calls selected auton from autonomous selector
@@ -181,11 +198,13 @@ void autonomous() {
  * task, not resume it from where it left off.
  */
 void opcontrol() {
+  startup.wait(); // Driving while the IMU calibrates ruins the calibration, and the timeline's initialize phase ends with it
+  timeline.phase_begin("opcontrol");
+  commands.invalidate(); // Autonomous wrote the drive directly, and nothing it left in the command buffer carries over
   // This is preference to what you like to drive on
   chassis.drive_brake_set(MOTOR_BRAKE_COAST);
 
   
-   while (true) {
         /*/
     // PID Tuner
     // After you find values that you're happy with, you'll have to set them in auton.cpp
@@ -215,20 +234,5 @@ void opcontrol() {
     // . . .
    /*/
 
-   if(master.get_digital_new_press(pros::E_CONTROLLER_DIGITAL_Y)){
-    climbAngleLock = !climbAngleLock;
-   }
-
-    intakeControl();
-    wingTeleControl();
-    ptoTeleControl();
-    climbReleaseTeleRelease();
-    scooperTeleControl();
-    climbTask();
-
-  
-
-    pros::delay(ez::util::DELAY_TIME); // This is used for timer calculations!  Keep this ez::util::DELAY_TIME)
-   }
+  scheduler.run(); // Runs the teleop callbacks every ez::util::DELAY_TIME.  Keep this at a fixed rate, it's used for timer calculations!
 }
-  
\ No newline at end of file
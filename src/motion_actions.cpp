@@ -0,0 +1,240 @@
+#include <atomic>
+
+#include "main.h"
+
+using namespace ez;
+
+// Pending actions live here instead of in Drive, firmware/EZ-Template.a was built against
+// Drive's current layout so it can't grow any members
+namespace {
+constexpr int ACTION_MAX = 16;
+
+enum action_trigger { DISTANCE,
+                      ANGLE,
+                      PROGRESS };
+
+struct Action {
+  std::function<void()> callback;
+  action_trigger trigger;
+  double threshold;
+
+  // The motion this belongs to, and where it started
+  std::uint32_t generation;
+  e_mode mode;
+  double targets[2];
+  double start_left;
+  double start_right;
+  double start_angle;
+  bool used = false;
+};
+
+Action actions[ACTION_MAX];
+// Made before main runs, so two tasks adding their first action can't each make one
+pros::Mutex actions_mutex;
+pros::task_t actions_task = nullptr;
+
+// Counts motions, every pid_*_set bumps it before the motion starts
+std::atomic<std::uint32_t> motion_generation{0};
+}  // namespace
+
+// pid_drive_set(), pid_turn_set(), pid_turn_relative_set() and pid_swing_set() are compiled into
+// firmware/EZ-Template.a, so the link wraps them (--wrap in the Makefile) to count motions.  A
+// motion only has to change the count, it doesn't matter if an overload counts it twice
+extern "C" {
+void __real__ZN2ez5Drive13pid_drive_setEdibb(Drive* drive, double target, int speed, bool slew_on, bool toggle_heading);
+void __real__ZN2ez5Drive13pid_drive_setEN5okapi9RQuantityISt5ratioILl0ELl1EES3_ILl1ELl1EES4_S4_EEibb(Drive* drive, okapi::QLength target, int speed, bool slew_on, bool toggle_heading);
+void __real__ZN2ez5Drive12pid_turn_setEdib(Drive* drive, double target, int speed, bool slew_on);
+void __real__ZN2ez5Drive12pid_turn_setEN5okapi9RQuantityISt5ratioILl0ELl1EES4_S4_S3_ILl1ELl1EEEEib(Drive* drive, okapi::QAngle target, int speed, bool slew_on);
+void __real__ZN2ez5Drive21pid_turn_relative_setEdib(Drive* drive, double target, int speed, bool slew_on);
+void __real__ZN2ez5Drive21pid_turn_relative_setEN5okapi9RQuantityISt5ratioILl0ELl1EES4_S4_S3_ILl1ELl1EEEEib(Drive* drive, okapi::QAngle target, int speed, bool slew_on);
+void __real__ZN2ez5Drive13pid_swing_setENS_7e_swingEdiib(Drive* drive, e_swing type, double target, int speed, int opposite_speed, bool slew_on);
+void __real__ZN2ez5Drive13pid_swing_setENS_7e_swingEN5okapi9RQuantityISt5ratioILl0ELl1EES5_S5_S4_ILl1ELl1EEEEiib(Drive* drive, e_swing type, okapi::QAngle target, int speed, int opposite_speed, bool slew_on);
+
+void __wrap__ZN2ez5Drive13pid_drive_setEdibb(Drive* drive, double target, int speed, bool slew_on, bool toggle_heading) {
+  motion_generation++;
+  __real__ZN2ez5Drive13pid_drive_setEdibb(drive, target, speed, slew_on, toggle_heading);
+}
+
+void __wrap__ZN2ez5Drive13pid_drive_setEN5okapi9RQuantityISt5ratioILl0ELl1EES3_ILl1ELl1EES4_S4_EEibb(Drive* drive, okapi::QLength target, int speed, bool slew_on, bool toggle_heading) {
+  motion_generation++;
+  __real__ZN2ez5Drive13pid_drive_setEN5okapi9RQuantityISt5ratioILl0ELl1EES3_ILl1ELl1EES4_S4_EEibb(drive, target, speed, slew_on, toggle_heading);
+}
+
+void __wrap__ZN2ez5Drive12pid_turn_setEdib(Drive* drive, double target, int speed, bool slew_on) {
+  motion_generation++;
+  __real__ZN2ez5Drive12pid_turn_setEdib(drive, target, speed, slew_on);
+}
+
+void __wrap__ZN2ez5Drive12pid_turn_setEN5okapi9RQuantityISt5ratioILl0ELl1EES4_S4_S3_ILl1ELl1EEEEib(Drive* drive, okapi::QAngle target, int speed, bool slew_on) {
+  motion_generation++;
+  __real__ZN2ez5Drive12pid_turn_setEN5okapi9RQuantityISt5ratioILl0ELl1EES4_S4_S3_ILl1ELl1EEEEib(drive, target, speed, slew_on);
+}
+
+void __wrap__ZN2ez5Drive21pid_turn_relative_setEdib(Drive* drive, double target, int speed, bool slew_on) {
+  motion_generation++;
+  __real__ZN2ez5Drive21pid_turn_relative_setEdib(drive, target, speed, slew_on);
+}
+
+void __wrap__ZN2ez5Drive21pid_turn_relative_setEN5okapi9RQuantityISt5ratioILl0ELl1EES4_S4_S3_ILl1ELl1EEEEib(Drive* drive, okapi::QAngle target, int speed, bool slew_on) {
+  motion_generation++;
+  __real__ZN2ez5Drive21pid_turn_relative_setEN5okapi9RQuantityISt5ratioILl0ELl1EES4_S4_S3_ILl1ELl1EEEEib(drive, target, speed, slew_on);
+}
+
+void __wrap__ZN2ez5Drive13pid_swing_setENS_7e_swingEdiib(Drive* drive, e_swing type, double target, int speed, int opposite_speed, bool slew_on) {
+  motion_generation++;
+  __real__ZN2ez5Drive13pid_swing_setENS_7e_swingEdiib(drive, type, target, speed, opposite_speed, slew_on);
+}
+
+void __wrap__ZN2ez5Drive13pid_swing_setENS_7e_swingEN5okapi9RQuantityISt5ratioILl0ELl1EES5_S5_S4_ILl1ELl1EEEEiib(Drive* drive, e_swing type, okapi::QAngle target, int speed, int opposite_speed, bool slew_on) {
+  motion_generation++;
+  __real__ZN2ez5Drive13pid_swing_setENS_7e_swingEN5okapi9RQuantityISt5ratioILl0ELl1EES5_S5_S4_ILl1ELl1EEEEiib(drive, type, target, speed, opposite_speed, slew_on);
+}
+}
+
+// Targets of the running motion, for PROGRESS
+static void motion_targets_get(Drive& drive, double* targets) {
+  switch (drive.drive_mode_get()) {
+    case DRIVE:
+      // A profiled drive moves its targets every step, its motion is where it ends
+      if (drive.pid_drive_profile_final_get(targets)) break;
+      targets[0] = drive.leftPID.target_get();
+      targets[1] = drive.rightPID.target_get();
+      break;
+    case TURN:
+      targets[0] = targets[1] = drive.turnPID.target_get();
+      break;
+    case SWING:
+      targets[0] = targets[1] = drive.swingPID.target_get();
+      break;
+    default:
+      targets[0] = targets[1] = 0;
+      break;
+  }
+}
+
+static bool action_reached(Drive& drive, const Action& action) {
+  double traveled = ((drive.drive_sensor_left() - action.start_left) + (drive.drive_sensor_right() - action.start_right)) / 2.0;
+  double turned = drive.drive_imu_get() - action.start_angle;
+
+  switch (action.trigger) {
+    case DISTANCE:
+      return fabs(traveled) >= action.threshold;
+    case ANGLE:
+      return fabs(turned) >= action.threshold;
+    case PROGRESS: {
+      double total;
+      double done;
+      if (action.mode == DRIVE) {
+        total = ((action.targets[0] - action.start_left) + (action.targets[1] - action.start_right)) / 2.0;
+        done = traveled;
+      } else {
+        total = action.targets[0] - action.start_angle;
+        done = turned;
+      }
+      // A motion that goes nowhere is already done
+      if (total == 0) return true;
+      return done / total >= action.threshold;
+    }
+  }
+  return true;
+}
+
+static void actions_task_function(void* parameter) {
+  Drive* drive = static_cast<Drive*>(parameter);
+  std::uint32_t now = pros::c::millis();
+  while (true) {
+    drive->pid_actions_step();
+    pros::c::task_delay_until(&now, util::DELAY_TIME);
+  }
+}
+
+void Drive::pid_action_add(int trigger, double threshold, std::function<void()> action) {
+  actions_mutex.take();
+  // The first action starts the task that runs them
+  if (!actions_task) actions_task = pros::c::task_create(actions_task_function, this, TASK_PRIORITY_DEFAULT, TASK_STACK_DEPTH_DEFAULT, "EZ Actions");
+  Action* slot = nullptr;
+  for (auto& a : actions) {
+    if (!a.used) {
+      slot = &a;
+      break;
+    }
+  }
+  if (slot) {
+    slot->callback = action;
+    slot->trigger = (action_trigger)trigger;
+    slot->threshold = threshold;
+    slot->generation = motion_generation;
+    slot->mode = drive_mode_get();
+    motion_targets_get(*this, slot->targets);
+    // Drives measure from where pid_drive_set started, so adding the action late doesn't shift it
+    slot->start_left = slot->mode == DRIVE ? l_start : drive_sensor_left();
+    slot->start_right = slot->mode == DRIVE ? r_start : drive_sensor_right();
+    slot->start_angle = drive_imu_get();
+    slot->used = true;
+  }
+  actions_mutex.give();
+
+  if (!slot) {
+    printf("Too many pending actions (%d), running this one now\n", ACTION_MAX);
+    action();
+  }
+}
+
+void Drive::pid_action_distance_add(okapi::QLength distance, std::function<void()> action) { pid_action_distance_add(distance.convert(okapi::inch), action); }
+
+void Drive::pid_action_distance_add(double distance, std::function<void()> action) { pid_action_add(DISTANCE, fabs(distance), action); }
+
+void Drive::pid_action_angle_add(okapi::QAngle angle, std::function<void()> action) { pid_action_angle_add(angle.convert(okapi::degree), action); }
+
+void Drive::pid_action_angle_add(double angle, std::function<void()> action) { pid_action_add(ANGLE, fabs(angle), action); }
+
+void Drive::pid_action_progress_add(double fraction, std::function<void()> action) { pid_action_add(PROGRESS, fraction, action); }
+
+void Drive::pid_actions_clear() {
+  actions_mutex.take();
+  for (auto& a : actions) {
+    a.callback = nullptr;
+    a.used = false;
+  }
+  actions_mutex.give();
+}
+
+int Drive::pid_actions_pending() {
+  int count = 0;
+  actions_mutex.take();
+  for (auto& a : actions) {
+    if (a.used) count++;
+  }
+  actions_mutex.give();
+  return count;
+}
+
+void Drive::pid_actions_step() {
+  // Due actions are moved out and run after the mutex is released, so an action can add another
+  std::function<void()> due[ACTION_MAX];
+  int count = 0;
+  std::uint32_t generation = motion_generation;
+  e_mode current = drive_mode_get();
+
+  actions_mutex.take();
+  for (auto& a : actions) {
+    if (!a.used) continue;
+
+    // Autonomous ended, nothing should move now
+    if (current == DISABLE) {
+      a.callback = nullptr;
+      a.used = false;
+      continue;
+    }
+
+    // The motion this was attached to was replaced before reaching the milestone, so run it now
+    if (a.generation != generation || action_reached(*this, a)) {
+      due[count++] = std::move(a.callback);
+      a.callback = nullptr;
+      a.used = false;
+    }
+  }
+  actions_mutex.give();
+
+  for (int i = 0; i < count; i++) due[i]();
+}
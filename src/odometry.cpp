@@ -0,0 +1,134 @@
+#include <atomic>
+#include <cmath>
+
+#include "main.h"
+
+using namespace ez;
+
+// Odometry state lives here instead of in Drive, firmware/EZ-Template.a was built against
+// Drive's current layout so it can't grow any members
+namespace {
+constexpr int ODOM_PERIOD = 5;
+constexpr int ODOM_PRIORITY = TASK_PRIORITY_DEFAULT + 2;
+
+// More than this in one step is an encoder being reset, not the robot moving
+constexpr double ODOM_JUMP_DISTANCE = 4.0;
+
+// The pose is only written by the odometry task.  Readers retry if the sequence was odd (mid
+// write) or changed while they copied, so reading never blocks and never sees a torn pose
+struct SharedPose {
+  std::atomic<std::uint32_t> sequence{0};
+  std::atomic<double> x{0};
+  std::atomic<double> y{0};
+  std::atomic<double> theta{0};
+};
+
+SharedPose odom_pose;
+SharedPose odom_requested;
+std::atomic<bool> odom_set_pending{false};
+std::atomic<bool> odom_running{false};
+pros::task_t odom_task = nullptr;
+}  // namespace
+
+static void shared_pose_write(SharedPose& shared, pose input) {
+  shared.sequence.fetch_add(1, std::memory_order_acq_rel);
+  shared.x.store(input.x, std::memory_order_relaxed);
+  shared.y.store(input.y, std::memory_order_relaxed);
+  shared.theta.store(input.theta, std::memory_order_relaxed);
+  shared.sequence.fetch_add(1, std::memory_order_release);
+}
+
+static pose shared_pose_read(const SharedPose& shared) {
+  pose output;
+  std::uint32_t before, after;
+  do {
+    before = shared.sequence.load(std::memory_order_acquire);
+    output.x = shared.x.load(std::memory_order_relaxed);
+    output.y = shared.y.load(std::memory_order_relaxed);
+    output.theta = shared.theta.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    after = shared.sequence.load(std::memory_order_relaxed);
+  } while ((before & 1) || before != after);
+  return output;
+}
+
+// Same arc step as okapi's TwoEncoderOdometry, but the heading comes from drive_heading_get()
+// instead of the difference between the sides.  The robot is assumed to have moved along an
+// arc, so the chord is applied at the average of the old and new heading
+static pose odom_math_step(pose current, double left_delta, double right_delta, double theta) {
+  double distance = (left_delta + right_delta) / 2.0;
+  double turned = (theta - current.theta) * M_PI / 180.0;
+  double chord = distance;
+  if (fabs(turned) > 1e-9) chord = 2.0 * sin(turned / 2.0) * distance / turned;
+
+  double heading = current.theta * M_PI / 180.0 + turned / 2.0;
+  current.x += chord * sin(heading);
+  current.y += chord * cos(heading);
+  current.theta = theta;
+  return current;
+}
+
+static void odom_task_function(void* parameter) {
+  Drive* drive = static_cast<Drive*>(parameter);
+  pose current = {0, 0, 0};
+  double heading_offset = 0;
+  double last_left = drive->drive_sensor_left();
+  double last_right = drive->drive_sensor_right();
+
+  std::uint32_t now = pros::c::millis();
+  std::uint32_t steps = 0;
+  TaskProfile* profile = profiler.add("odometry", ODOM_PERIOD);
+  while (true) {
+    {
+      TaskProfile::Scope cycle(profile);
+      double left = drive->drive_sensor_left();
+      double right = drive->drive_sensor_right();
+      double imu = drive->drive_imu_get();
+      double left_delta = left - last_left;
+      double right_delta = right - last_right;
+
+      // The pose turns with the fused heading.  A reset IMU keeps the heading the pose had
+      // instead of snapping to the new reading
+      bool resynced = drive->drive_heading_step(left_delta, right_delta, imu);
+      double heading = drive->drive_heading_get();
+      if (resynced) heading_offset = current.theta - heading;
+
+      if (odom_set_pending.exchange(false, std::memory_order_acquire)) {
+        current = shared_pose_read(odom_requested);
+        heading_offset = current.theta - heading;
+        shared_pose_write(odom_pose, current);
+      } else if (odom_running.load(std::memory_order_relaxed) && std::isfinite(imu)) {
+        bool jumped = fabs(left_delta) > ODOM_JUMP_DISTANCE || fabs(right_delta) > ODOM_JUMP_DISTANCE;
+        if (!jumped) {
+          current = odom_math_step(current, left_delta, right_delta, heading + heading_offset);
+          shared_pose_write(odom_pose, current);
+        }
+      }
+
+      // A running motion means the drive task is ticking
+      if (drive->drive_mode_get() != DISABLE) timeline.tick();
+      timeline.output_check(*drive);
+
+      // Telemetry at the drive task's 10ms
+      if (++steps % 2 == 0) telemetry.drive_record();
+
+      last_left = left;
+      last_right = right;
+    }
+    pros::c::task_delay_until(&now, ODOM_PERIOD);
+  }
+}
+
+void Drive::odom_enable(bool input) {
+  odom_running = input;
+  if (input && !odom_task) odom_task = pros::c::task_create(odom_task_function, this, ODOM_PRIORITY, TASK_STACK_DEPTH_DEFAULT, "EZ Odometry");
+}
+
+bool Drive::odom_enabled() { return odom_running; }
+
+pose Drive::odom_pose_get() { return shared_pose_read(odom_pose); }
+
+void Drive::odom_pose_set(pose input) {
+  shared_pose_write(odom_requested, input);
+  odom_set_pending.store(true, std::memory_order_release);
+}
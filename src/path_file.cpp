@@ -0,0 +1,69 @@
+#include "path_file.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+#include "crc16.hpp"
+
+static const char PATH_FILE_MAGIC[4] = {'E', 'Z', 'P', 'F'};
+
+// CRC of the header up to the crc field, then every column
+static std::uint16_t path_file_crc(const PathFileHeader& header, const std::uint8_t* columns) {
+  std::uint16_t crc = crc16((const std::uint8_t*)&header, offsetof(PathFileHeader, crc));
+  return crc16(columns, path_file_size(header.count) - sizeof(PathFileHeader), crc);
+}
+
+std::size_t path_file_write(const PathProfile& path, std::uint8_t* output) {
+  PathFileHeader header = {};
+  if (!path.name || std::strlen(path.name) >= PATH_FILE_NAME_SIZE) return 0;
+  std::memcpy(header.magic, PATH_FILE_MAGIC, sizeof(header.magic));
+  header.version = PATH_FILE_VERSION;
+  header.flags = path.reversed ? PATH_FILE_REVERSED : 0;
+  header.count = path.count;
+  header.dt = path.dt;
+  std::strcpy(header.name, path.name);
+
+  std::uint8_t* columns = output + sizeof(header);
+  const float* fields[PATH_FILE_COLUMNS] = {path.x, path.y, path.theta, path.velocity, path.curvature, path.distance};
+  std::size_t column_size = path.count * sizeof(float);
+  for (int i = 0; i < PATH_FILE_COLUMNS; i++) std::memcpy(columns + i * column_size, fields[i], column_size);
+
+  header.crc = path_file_crc(header, columns);
+  std::memcpy(output, &header, sizeof(header));
+  return path_file_size(path.count);
+}
+
+bool path_file_parse(const std::uint8_t* data, std::size_t size, PathProfile& path) {
+  if (size < sizeof(PathFileHeader) || (std::uintptr_t)data % alignof(float) != 0) return false;
+  const PathFileHeader& header = *(const PathFileHeader*)data;
+  if (std::memcmp(header.magic, PATH_FILE_MAGIC, sizeof(header.magic)) || header.version != PATH_FILE_VERSION) return false;
+  // Bounded first, a corrupt count would overflow path_file_size() where size_t is 32 bits
+  if (header.count == 0 || header.count > (size - sizeof(PathFileHeader)) / (PATH_FILE_COLUMNS * sizeof(float))) return false;
+  if (size != path_file_size(header.count)) return false;
+  if (!std::memchr(header.name, 0, sizeof(header.name))) return false;
+  const std::uint8_t* columns = data + sizeof(header);
+  if (path_file_crc(header, columns) != header.crc) return false;
+
+  const float* column = (const float*)columns;
+  path.name = header.name;
+  path.count = header.count;
+  path.dt = header.dt;
+  path.reversed = header.flags & PATH_FILE_REVERSED;
+  path.x = column;
+  path.y = column + header.count;
+  path.theta = column + 2 * header.count;
+  path.velocity = column + 3 * header.count;
+  path.curvature = column + 4 * header.count;
+  path.distance = column + 5 * header.count;
+  return true;
+}
+
+bool path_file_load(const char* filename, std::uint8_t* buffer, std::size_t capacity, PathProfile& path) {
+  FILE* file = fopen(filename, "rb");
+  if (!file) return false;
+  std::size_t size = fread(buffer, 1, capacity, file);
+  // A full buffer could be a file that's bigger than it
+  bool whole = size < capacity || fgetc(file) == EOF;
+  fclose(file);
+  return whole && path_file_parse(buffer, size, path);
+}
@@ -0,0 +1,275 @@
+// Generated by sim/bin/pathgen from include/path_specs.hpp, edit that instead
+
+#include "paths.hpp"
+
+// 200 points, 1.99s, 71.6in
+static const float example_curve_x[] = {
+    0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00001f, 0.00002f, 0.00004f, 0.00008f,
+    0.00014f, 0.00025f, 0.00042f, 0.00068f, 0.00106f, 0.00160f, 0.00235f, 0.00336f, 0.00472f, 0.00652f,
+    0.00884f, 0.01181f, 0.01556f, 0.02026f, 0.02608f, 0.03323f, 0.04194f, 0.05248f, 0.06513f, 0.08024f,
+    0.09817f, 0.11935f, 0.14423f, 0.17332f, 0.20720f, 0.24650f, 0.29191f, 0.34420f, 0.40421f, 0.47218f,
+    0.54689f, 0.62844f, 0.71702f, 0.81279f, 0.91591f, 1.02653f, 1.14478f, 1.27081f, 1.40473f, 1.54666f,
+    1.69672f, 1.85502f, 2.02167f, 2.19678f, 2.38048f, 2.57286f, 2.77405f, 2.98415f, 3.20329f, 3.43155f,
+    3.66905f, 3.91587f, 4.17208f, 4.43776f, 4.71294f, 4.99764f, 5.29186f, 5.59556f, 5.90868f, 6.23113f,
+    6.56278f, 6.90345f, 7.25295f, 7.61105f, 7.97748f, 8.35194f, 8.73410f, 9.12359f, 9.52003f, 9.92301f,
+    10.33209f, 10.74682f, 11.16673f, 11.59134f, 12.02005f, 12.44779f, 12.87189f, 13.29248f, 13.70969f, 14.12364f,
+    14.53444f, 14.94222f, 15.34709f, 15.74918f, 16.14862f, 16.54552f, 16.94002f, 17.33225f, 17.72236f, 18.11049f,
+    18.49680f, 18.88145f, 19.26463f, 19.64651f, 20.02731f, 20.40724f, 20.78654f, 21.16547f, 21.54431f, 21.92338f,
+    22.30261f, 22.67499f, 23.03805f, 23.39202f, 23.73712f, 24.07358f, 24.40107f, 24.71833f, 25.02418f, 25.31762f,
+    25.59778f, 25.86390f, 26.11526f, 26.35127f, 26.57138f, 26.77515f, 26.96223f, 27.13242f, 27.28591f, 27.42329f,
+    27.54516f, 27.65212f, 27.74475f, 27.82354f, 27.88890f, 27.94114f, 27.98048f, 28.00699f, 28.02066f, 28.02133f,
+    28.00878f, 27.98267f, 27.94261f, 27.88825f, 27.81948f, 27.73646f, 27.63955f, 27.52927f, 27.40629f, 27.27140f,
+    27.12552f, 26.96963f, 26.80482f, 26.63226f, 26.45322f, 26.26904f, 26.08118f, 25.89149f, 25.70771f, 25.53337f,
+    25.36893f, 25.21446f, 25.07082f, 24.93837f, 24.81709f, 24.70684f, 24.60732f, 24.51813f, 24.43880f, 24.36877f,
+    24.30744f, 24.25414f, 24.20822f, 24.16899f, 24.13578f, 24.10792f, 24.08480f, 24.06580f, 24.05038f, 24.03800f,
+    24.02821f, 24.02057f, 24.01470f, 24.01028f, 24.00701f, 24.00465f, 24.00298f, 24.00184f, 24.00109f, 24.00061f,
+    24.00032f, 24.00016f, 24.00007f, 24.00003f, 24.00001f, 24.00000f, 24.00000f, 24.00000f, 24.00000f, 24.00000f,
+};
+static const float example_curve_y[] = {
+    0.00000f, 0.01248f, 0.02496f, 0.05421f, 0.09638f, 0.15020f, 0.21617f, 0.29412f, 0.38407f, 0.48607f,
+    0.60003f, 0.72601f, 0.86404f, 1.01401f, 1.17603f, 1.35001f, 1.53602f, 1.73400f, 1.94400f, 2.16600f,
+    2.39998f, 2.64597f, 2.90394f, 3.17389f, 3.45583f, 3.74974f, 4.05562f, 4.37345f, 4.70320f, 5.04487f,
+    5.39841f, 5.76380f, 6.14097f, 6.52989f, 6.93045f, 7.34258f, 7.76615f, 8.20102f, 8.64699f, 9.09964f,
+    9.54731f, 9.98925f, 10.42542f, 10.85577f, 11.28030f, 11.69900f, 12.11190f, 12.51903f, 12.92047f, 13.31631f,
+    13.70665f, 14.09163f, 14.47142f, 14.84617f, 15.21609f, 15.58138f, 15.94226f, 16.29895f, 16.65171f, 17.00076f,
+    17.34637f, 17.68878f, 18.02825f, 18.36503f, 18.69939f, 19.03157f, 19.36185f, 19.69048f, 20.01771f, 20.34381f,
+    20.66905f, 20.99370f, 21.31802f, 21.64229f, 21.96679f, 22.29179f, 22.61758f, 22.94443f, 23.27262f, 23.60243f,
+    23.93412f, 24.26795f, 24.60418f, 24.94303f, 25.28465f, 25.62557f, 25.96422f, 26.30117f, 26.63694f, 26.97198f,
+    27.30671f, 27.64149f, 27.97666f, 28.31252f, 28.64933f, 28.98734f, 29.32677f, 29.66782f, 30.01066f, 30.35547f,
+    30.70238f, 31.05153f, 31.40303f, 31.75700f, 32.11353f, 32.47270f, 32.83461f, 33.19931f, 33.56687f, 33.93736f,
+    34.31043f, 34.67880f, 35.03954f, 35.39240f, 35.73715f, 36.07358f, 36.40200f, 36.72367f, 37.03971f, 37.35100f,
+    37.65824f, 37.96194f, 38.26246f, 38.56002f, 38.85467f, 39.14632f, 39.43475f, 39.71957f, 40.00078f, 40.27889f,
+    40.55453f, 40.82837f, 41.10118f, 41.37377f, 41.64703f, 41.92189f, 42.19933f, 42.48039f, 42.76612f, 43.05761f,
+    43.35593f, 43.66219f, 43.97749f, 44.30257f, 44.63717f, 44.98088f, 45.33341f, 45.69455f, 46.06424f, 46.44252f,
+    46.82954f, 47.22558f, 47.63097f, 48.04616f, 48.47164f, 48.90797f, 49.35578f, 49.81496f, 50.27078f, 50.71744f,
+    51.15581f, 51.58728f, 52.01054f, 52.42487f, 52.83009f, 53.22600f, 53.61236f, 53.98892f, 54.35541f, 54.71157f,
+    55.05715f, 55.39191f, 55.71565f, 56.02818f, 56.32933f, 56.61898f, 56.89700f, 57.16330f, 57.41782f, 57.66049f,
+    57.89126f, 58.11011f, 58.31701f, 58.51194f, 58.69489f, 58.86586f, 59.02483f, 59.17181f, 59.30679f, 59.42976f,
+    59.54076f, 59.63975f, 59.72673f, 59.80167f, 59.86461f, 59.91561f, 59.95453f, 59.98112f, 59.99304f, 60.00000f,
+};
+static const float example_curve_theta[] = {
+    0.00000f, 0.00004f, 0.00007f, 0.00034f, 0.00108f, 0.00258f, 0.00533f, 0.00983f, 0.01671f, 0.02669f,
+    0.04055f, 0.05917f, 0.08355f, 0.11467f, 0.15371f, 0.20182f, 0.26032f, 0.33054f, 0.41394f, 0.51205f,
+    0.62646f, 0.75891f, 0.91118f, 1.08520f, 1.28303f, 1.50684f, 1.75891f, 2.04176f, 2.35797f, 2.71042f,
+    3.10209f, 3.53627f, 4.01641f, 4.54626f, 5.12976f, 5.77121f, 6.47505f, 7.24601f, 8.08902f, 9.00038f,
+    9.95837f, 10.96072f, 12.00624f, 13.09346f, 14.22063f, 15.38573f, 16.58640f, 17.81998f, 19.08352f, 20.37373f,
+    21.68704f, 23.01960f, 24.36733f, 25.72588f, 27.09075f, 28.45725f, 29.82059f, 31.17590f, 32.51826f, 33.84278f,
+    35.14463f, 36.41906f, 37.66148f, 38.86749f, 40.03292f, 41.15390f, 42.22681f, 43.24842f, 44.21582f, 45.12648f,
+    45.97831f, 46.76957f, 47.49894f, 48.16550f, 48.76876f, 49.30854f, 49.78508f, 50.19897f, 50.55112f, 50.84273f,
+    51.07534f, 51.25074f, 51.37098f, 51.43832f, 51.45527f, 51.42513f, 51.35259f, 51.24220f, 51.09813f, 50.92421f,
+    50.72400f, 50.50080f, 50.25773f, 49.99771f, 49.72353f, 49.43783f, 49.14314f, 48.84192f, 48.53654f, 48.22932f,
+    47.92254f, 47.61845f, 47.31931f, 47.02736f, 46.74487f, 46.47416f, 46.21762f, 45.97771f, 45.75701f, 45.55824f,
+    45.38448f, 45.24131f, 45.13087f, 45.05373f, 45.01033f, 44.99314f, 44.80089f, 44.36792f, 43.71740f, 42.86502f,
+    41.82152f, 40.59444f, 39.18980f, 37.61327f, 35.87144f, 33.97295f, 31.92933f, 29.75584f, 27.46791f, 25.07857f,
+    22.60139f, 20.05067f, 17.44126f, 14.78846f, 12.10791f, 9.41556f, 6.72760f, 4.06043f, 1.43061f, -1.14515f,
+    -3.65010f, -6.06751f, -8.38079f, -10.57179f, -12.61776f, -14.49955f, -16.20315f, -17.71922f, -19.04215f, -20.16934f,
+    -21.10026f, -21.83570f, -22.37707f, -22.72608f, -22.88440f, -22.85340f, -22.63425f, -22.22881f, -21.66101f, -20.95931f,
+    -20.14421f, -19.23231f, -18.24418f, -17.19886f, -16.11300f, -15.00229f, -13.88131f, -12.76354f, -11.66118f, -10.58511f,
+    -9.54481f, -8.54829f, -7.60213f, -6.71146f, -5.88010f, -5.11057f, -4.40421f, -3.76132f, -3.18131f, -2.66275f,
+    -2.20352f, -1.80094f, -1.45180f, -1.15265f, -0.89957f, -0.68859f, -0.51554f, -0.37623f, -0.26643f, -0.18208f,
+    -0.11914f, -0.07389f, -0.04282f, -0.02271f, -0.01066f, -0.00416f, -0.00122f, -0.00023f, -0.00006f, 0.00000f,
+};
+static const float example_curve_velocity[] = {
+    0.00000f, 1.20000f, 2.40000f, 3.60000f, 4.80000f, 6.00000f, 7.20000f, 8.40000f, 9.60000f, 10.80000f,
+    12.00000f, 13.20000f, 14.40000f, 15.60000f, 16.80000f, 18.00000f, 19.20000f, 20.40000f, 21.60000f, 22.80000f,
+    24.00000f, 25.20000f, 26.40000f, 27.60000f, 28.80000f, 30.00000f, 31.20000f, 32.40000f, 33.60000f, 34.80000f,
+    36.00000f, 37.20000f, 38.40000f, 39.60000f, 40.80000f, 42.00000f, 43.20000f, 44.40000f, 45.60000f, 45.61197f,
+    45.16154f, 44.72194f, 44.29566f, 43.88543f, 43.49413f, 43.12482f, 42.78061f, 42.46465f, 42.18005f, 41.92981f,
+    41.71682f, 41.54374f, 41.41298f, 41.32664f, 41.28654f, 41.29403f, 41.35012f, 41.45536f, 41.60989f, 41.81335f,
+    42.06493f, 42.36340f, 42.70704f, 43.09373f, 43.52092f, 43.98573f, 44.48493f, 45.01503f, 45.57232f, 46.15289f,
+    46.75277f, 47.36789f, 47.99421f, 48.62774f, 49.26458f, 49.90094f, 50.53323f, 51.15800f, 51.77203f, 52.37226f,
+    52.95586f, 53.52018f, 54.06277f, 54.58137f, 54.92641f, 54.47680f, 54.07485f, 53.71650f, 53.39820f, 53.11692f,
+    52.87004f, 52.65533f, 52.47086f, 52.31497f, 52.18625f, 52.08353f, 52.00580f, 51.95225f, 51.92225f, 51.91529f,
+    51.93105f, 51.96936f, 52.03020f, 52.11372f, 52.22025f, 52.35032f, 52.50467f, 52.68429f, 52.89048f, 53.12483f,
+    52.98017f, 51.78017f, 50.58017f, 49.38017f, 48.18017f, 46.98017f, 45.78017f, 44.58017f, 43.38017f, 42.18017f,
+    40.98017f, 39.78017f, 38.58017f, 37.38017f, 36.18017f, 34.98017f, 33.78017f, 32.59163f, 31.50817f, 30.55730f,
+    29.74657f, 29.08219f, 28.56925f, 28.21174f, 28.01289f, 27.97533f, 28.10135f, 28.39285f, 28.85134f, 29.47789f,
+    30.27266f, 31.23474f, 32.36152f, 33.56152f, 34.76152f, 35.96152f, 37.16152f, 38.36152f, 39.56152f, 40.76152f,
+    41.96152f, 43.16152f, 44.36152f, 45.56152f, 46.76152f, 47.96152f, 49.16152f, 49.74708f, 48.54708f, 47.35914f,
+    46.30756f, 45.29835f, 44.09835f, 42.89835f, 41.69835f, 40.49835f, 39.29835f, 38.09835f, 36.89835f, 35.69835f,
+    34.49835f, 33.29835f, 32.09835f, 30.89835f, 29.69835f, 28.49835f, 27.29835f, 26.09835f, 24.89835f, 23.69835f,
+    22.49835f, 21.29835f, 20.09835f, 18.89835f, 17.69835f, 16.49835f, 15.29835f, 14.09835f, 12.89835f, 11.69835f,
+    10.49835f, 9.29835f, 8.09835f, 6.89835f, 5.69835f, 4.49835f, 3.29835f, 2.09835f, 0.89835f, 0.00000f,
+};
+static const float example_curve_curvature[] = {
+    0.00000f, 0.00005f, 0.00010f, 0.00022f, 0.00038f, 0.00060f, 0.00086f, 0.00116f, 0.00151f, 0.00190f,
+    0.00234f, 0.00282f, 0.00334f, 0.00390f, 0.00451f, 0.00515f, 0.00583f, 0.00655f, 0.00731f, 0.00811f,
+    0.00895f, 0.00984f, 0.01076f, 0.01174f, 0.01275f, 0.01382f, 0.01494f, 0.01611f, 0.01734f, 0.01863f,
+    0.01999f, 0.02142f, 0.02292f, 0.02450f, 0.02617f, 0.02792f, 0.02976f, 0.03169f, 0.03371f, 0.03580f,
+    0.03789f, 0.03997f, 0.04203f, 0.04405f, 0.04601f, 0.04789f, 0.04967f, 0.05134f, 0.05286f, 0.05421f,
+    0.05538f, 0.05633f, 0.05706f, 0.05754f, 0.05777f, 0.05772f, 0.05741f, 0.05682f, 0.05597f, 0.05485f,
+    0.05348f, 0.05188f, 0.05006f, 0.04805f, 0.04587f, 0.04355f, 0.04111f, 0.03858f, 0.03598f, 0.03334f,
+    0.03068f, 0.02802f, 0.02539f, 0.02279f, 0.02025f, 0.01777f, 0.01537f, 0.01306f, 0.01084f, 0.00873f,
+    0.00671f, 0.00481f, 0.00301f, 0.00133f, -0.00023f, -0.00167f, -0.00298f, -0.00416f, -0.00522f, -0.00617f,
+    -0.00701f, -0.00774f, -0.00838f, -0.00893f, -0.00938f, -0.00974f, -0.01001f, -0.01020f, -0.01031f, -0.01033f,
+    -0.01028f, -0.01014f, -0.00993f, -0.00963f, -0.00926f, -0.00880f, -0.00827f, -0.00764f, -0.00694f, -0.00614f,
+    -0.00525f, -0.00428f, -0.00324f, -0.00213f, -0.00096f, -0.00229f, -0.01210f, -0.02133f, -0.03032f, -0.03928f,
+    -0.04840f, -0.05777f, -0.06748f, -0.07753f, -0.08788f, -0.09846f, -0.10909f, -0.11957f, -0.12967f, -0.13911f,
+    -0.14764f, -0.15499f, -0.16090f, -0.16514f, -0.16754f, -0.16800f, -0.16647f, -0.16298f, -0.15762f, -0.15057f,
+    -0.14206f, -0.13232f, -0.12166f, -0.11036f, -0.09874f, -0.08710f, -0.07566f, -0.06461f, -0.05406f, -0.04406f,
+    -0.03465f, -0.02580f, -0.01750f, -0.00971f, -0.00237f, 0.00456f, 0.01111f, 0.01730f, 0.02296f, 0.02806f,
+    0.03265f, 0.03675f, 0.04035f, 0.04346f, 0.04608f, 0.04819f, 0.04981f, 0.05094f, 0.05160f, 0.05181f,
+    0.05158f, 0.05096f, 0.04998f, 0.04866f, 0.04706f, 0.04520f, 0.04313f, 0.04088f, 0.03848f, 0.03598f,
+    0.03339f, 0.03075f, 0.02810f, 0.02544f, 0.02281f, 0.02024f, 0.01774f, 0.01533f, 0.01304f, 0.01089f,
+    0.00889f, 0.00706f, 0.00541f, 0.00396f, 0.00272f, 0.00171f, 0.00093f, 0.00039f, 0.00014f, -0.00000f,
+};
+static const float example_curve_distance[] = {
+    0.00000f, 0.01248f, 0.02496f, 0.05421f, 0.09638f, 0.15020f, 0.21617f, 0.29412f, 0.38407f, 0.48607f,
+    0.60003f, 0.72601f, 0.86404f, 1.01401f, 1.17603f, 1.35001f, 1.53602f, 1.73401f, 1.94401f, 2.16602f,
+    2.40001f, 2.64601f, 2.90401f, 3.17400f, 3.45601f, 3.75001f, 4.05600f, 4.37401f, 4.70401f, 5.04601f,
+    5.40000f, 5.76601f, 6.14400f, 6.53401f, 6.93600f, 7.35000f, 7.77600f, 8.21400f, 8.66400f, 9.12174f,
+    9.57559f, 10.02500f, 10.47008f, 10.91097f, 11.34785f, 11.78092f, 12.21043f, 12.63663f, 13.05983f, 13.48035f,
+    13.89855f, 14.31482f, 14.72956f, 15.14322f, 15.55625f, 15.96911f, 16.38229f, 16.79628f, 17.21157f, 17.62864f,
+    18.04799f, 18.47010f, 18.89541f, 19.32438f, 19.75742f, 20.19493f, 20.63725f, 21.08473f, 21.53764f, 21.99625f,
+    22.46077f, 22.93136f, 23.40816f, 23.89127f, 24.38073f, 24.87655f, 25.37873f, 25.88720f, 26.40185f, 26.92259f,
+    27.44925f, 27.98164f, 28.51958f, 29.06282f, 29.61100f, 30.15797f, 30.70070f, 31.23962f, 31.77516f, 32.30770f,
+    32.83761f, 33.36522f, 33.89082f, 34.41473f, 34.93721f, 35.45854f, 35.97897f, 36.49873f, 37.01809f, 37.53725f,
+    38.05647f, 38.57595f, 39.09593f, 39.61663f, 40.13828f, 40.66111f, 41.18537f, 41.71129f, 42.23914f, 42.76920f,
+    43.30117f, 43.82497f, 44.33677f, 44.83658f, 45.32438f, 45.80018f, 46.26398f, 46.71579f, 47.15559f, 47.58339f,
+    47.99919f, 48.40299f, 48.79479f, 49.17459f, 49.54240f, 49.89820f, 50.24200f, 50.57382f, 50.89421f, 51.20442f,
+    51.50582f, 51.79984f, 52.08797f, 52.37175f, 52.65274f, 52.93254f, 53.21279f, 53.49512f, 53.78120f, 54.07271f,
+    54.37132f, 54.67872f, 54.99657f, 55.32618f, 55.66780f, 56.02141f, 56.38703f, 56.76464f, 57.15425f, 57.55587f,
+    57.96949f, 58.39510f, 58.83272f, 59.28233f, 59.74395f, 60.21756f, 60.70318f, 61.20000f, 61.69147f, 62.17096f,
+    62.63916f, 63.09745f, 63.54443f, 63.97941f, 64.40240f, 64.81338f, 65.21236f, 65.59935f, 65.97433f, 66.33731f,
+    66.68829f, 67.02728f, 67.35426f, 67.66925f, 67.97223f, 68.26321f, 68.54220f, 68.80918f, 69.06416f, 69.30715f,
+    69.53813f, 69.75711f, 69.96410f, 70.15907f, 70.34206f, 70.51305f, 70.67203f, 70.81900f, 70.95399f, 71.07697f,
+    71.18796f, 71.28695f, 71.37393f, 71.44888f, 71.51181f, 71.56281f, 71.60173f, 71.62833f, 71.64024f, 71.64720f,
+};
+const PathProfile path_example_curve = {"example_curve", 200, 0.010f, false, example_curve_x, example_curve_y, example_curve_theta, example_curve_velocity, example_curve_curvature, example_curve_distance};
+
+// 196 points, 1.95s, 71.1in
+static const float example_return_x[] = {
+    24.00000f, 24.00000f, 24.00000f, 24.00000f, 24.00000f, 23.99999f, 23.99998f, 23.99996f, 23.99990f, 23.99981f,
+    23.99964f, 23.99936f, 23.99892f, 23.99826f, 23.99729f, 23.99592f, 23.99401f, 23.99142f, 23.98796f, 23.98340f,
+    23.97751f, 23.96997f, 23.96044f, 23.94853f, 23.93378f, 23.91566f, 23.89359f, 23.86691f, 23.83486f, 23.79662f,
+    23.75124f, 23.69770f, 23.63486f, 23.56147f, 23.47664f, 23.38250f, 23.27944f, 23.16733f, 23.04607f, 22.91553f,
+    22.77561f, 22.62619f, 22.46716f, 22.29837f, 22.11970f, 21.93098f, 21.73207f, 21.52280f, 21.30301f, 21.07252f,
+    20.83118f, 20.57884f, 20.31536f, 20.04064f, 19.75457f, 19.45711f, 19.14821f, 18.82789f, 18.49618f, 18.15316f,
+    17.79893f, 17.43361f, 17.05737f, 16.67039f, 16.27286f, 15.86497f, 15.44695f, 15.01897f, 14.58125f, 14.13394f,
+    13.67720f, 13.21115f, 12.73587f, 12.25138f, 11.75989f, 11.27519f, 10.79970f, 10.33343f, 9.87648f, 9.42896f,
+    8.99101f, 8.56281f, 8.14454f, 7.73643f, 7.33865f, 6.95142f, 6.57494f, 6.20937f, 5.85488f, 5.51159f,
+    5.17963f, 4.85904f, 4.54988f, 4.25215f, 3.96583f, 3.69084f, 3.42711f, 3.17451f, 2.93291f, 2.70218f,
+    2.48214f, 2.27263f, 2.07348f, 1.88454f, 1.70563f, 1.53662f, 1.37736f, 1.22772f, 1.08759f, 0.95683f,
+    0.83535f, 0.72304f, 0.61977f, 0.52543f, 0.43987f, 0.36294f, 0.29444f, 0.23417f, 0.18186f, 0.13721f,
+    0.09989f, 0.06947f, 0.04551f, 0.02746f, 0.01470f, 0.00650f, 0.00203f, 0.00027f, 0.00000f, 0.00000f,
+    0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f,
+    0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f,
+    -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f,
+    -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f,
+    -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f,
+    -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f,
+    -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, 0.00000f,
+};
+static const float example_return_y[] = {
+    60.00000f, 59.98752f, 59.97504f, 59.94579f, 59.90362f, 59.84980f, 59.78383f, 59.70588f, 59.61593f, 59.51393f,
+    59.39997f, 59.27400f, 59.13596f, 58.98599f, 58.82397f, 58.65000f, 58.46400f, 58.26604f, 58.05605f, 57.83410f,
+    57.60019f, 57.35429f, 57.09647f, 56.82673f, 56.54512f, 56.25168f, 55.94648f, 55.62961f, 55.30117f, 54.96132f,
+    54.61025f, 54.24819f, 53.87545f, 53.49243f, 53.10155f, 52.71656f, 52.33984f, 51.97123f, 51.61050f, 51.25743f,
+    50.91179f, 50.57330f, 50.24172f, 49.91677f, 49.59818f, 49.28569f, 48.97903f, 48.67796f, 48.38223f, 48.09162f,
+    47.80590f, 47.52490f, 47.24842f, 46.97628f, 46.70834f, 46.44442f, 46.18437f, 45.92804f, 45.67527f, 45.42587f,
+    45.17966f, 44.93643f, 44.69593f, 44.45790f, 44.22203f, 43.98799f, 43.75539f, 43.52378f, 43.29269f, 43.06158f,
+    42.82981f, 42.59672f, 42.36151f, 42.12331f, 41.88222f, 41.64394f, 41.40868f, 41.17554f, 40.94376f, 40.71263f,
+    40.48155f, 40.24996f, 40.01738f, 39.78338f, 39.54756f, 39.30958f, 39.06915f, 38.82598f, 38.57984f, 38.33052f,
+    38.07782f, 37.82158f, 37.56162f, 37.29779f, 37.02994f, 36.75790f, 36.48152f, 36.20062f, 35.91502f, 35.62452f,
+    35.32891f, 35.02797f, 34.72144f, 34.40909f, 34.09064f, 33.76584f, 33.43441f, 33.09609f, 32.75061f, 32.39772f,
+    32.03717f, 31.66874f, 31.29222f, 30.90741f, 30.51414f, 30.11225f, 29.70158f, 29.28199f, 28.85334f, 28.41545f,
+    27.96815f, 27.51119f, 27.04426f, 26.56699f, 26.07885f, 25.57916f, 25.06744f, 24.54372f, 24.00799f, 23.46084f,
+    22.91084f, 22.36084f, 21.81084f, 21.26084f, 20.71084f, 20.16084f, 19.61084f, 19.06084f, 18.51084f, 17.96084f,
+    17.41084f, 16.86084f, 16.31084f, 15.76084f, 15.21084f, 14.66084f, 14.11084f, 13.56084f, 13.01084f, 12.46125f,
+    11.92037f, 11.39150f, 10.87463f, 10.36976f, 9.87688f, 9.39601f, 8.92714f, 8.47026f, 8.02539f, 7.59252f,
+    7.17165f, 6.76277f, 6.36590f, 5.98103f, 5.60815f, 5.24728f, 4.89841f, 4.56154f, 4.23666f, 3.92379f,
+    3.62292f, 3.33404f, 3.05717f, 2.79230f, 2.53943f, 2.29856f, 2.06968f, 1.85281f, 1.64793f, 1.45507f,
+    1.27420f, 1.10532f, 0.94844f, 0.80358f, 0.67071f, 0.54984f, 0.44098f, 0.34409f, 0.25921f, 0.18635f,
+    0.12555f, 0.07673f, 0.03997f, 0.01493f, 0.00532f, 0.00000f,
+};
+static const float example_return_theta[] = {
+    0.00000f, 0.00010f, 0.00019f, 0.00088f, 0.00277f, 0.00664f, 0.01371f, 0.02527f, 0.04290f, 0.06847f,
+    0.10391f, 0.15149f, 0.21370f, 0.29300f, 0.39236f, 0.51465f, 0.66321f, 0.84131f, 1.05274f, 1.30123f,
+    1.59089f, 1.92619f, 2.31159f, 2.75219f, 3.25314f, 3.82016f, 4.45913f, 5.17651f, 5.97897f, 6.87359f,
+    7.86767f, 8.96887f, 10.18466f, 11.52243f, 12.98155f, 14.51255f, 16.10121f, 17.74239f, 19.43058f, 21.16002f,
+    22.92464f, 24.71813f, 26.53400f, 28.36561f, 30.20619f, 32.04894f, 33.88706f, 35.71381f, 37.52256f, 39.30686f,
+    41.06048f, 42.77747f, 44.45215f, 46.07930f, 47.65399f, 49.17180f, 50.62868f, 52.02107f, 53.34581f, 54.60024f,
+    55.78199f, 56.88917f, 57.92008f, 58.87336f, 59.74778f, 60.54230f, 61.25587f, 61.88738f, 62.43560f, 62.89906f,
+    63.27596f, 63.56401f, 63.76031f, 63.86124f, 63.86240f, 63.76372f, 63.56956f, 63.28360f, 62.90874f, 62.44724f,
+    61.90095f, 61.27135f, 60.55968f, 59.76699f, 58.89438f, 57.94291f, 56.91377f, 55.80836f, 54.62830f, 53.37554f,
+    52.05236f, 50.66150f, 49.20607f, 47.68964f, 46.11619f, 44.49021f, 42.81654f, 41.10049f, 39.34765f, 37.56398f,
+    35.75572f, 33.92931f, 32.09138f, 30.24866f, 28.40795f, 26.57607f, 24.75975f, 22.96566f, 21.20030f, 19.46998f,
+    17.78077f, 16.13845f, 14.54852f, 13.01616f, 11.54619f, 10.14320f, 8.81142f, 7.55492f, 6.37753f, 5.28305f,
+    4.27531f, 3.35835f, 2.53671f, 1.81543f, 1.20073f, 0.70025f, 0.32421f, 0.08547f, 0.00006f, 0.00000f,
+    0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f,
+    0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f,
+    0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f,
+    0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f,
+    0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f,
+    0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f,
+    0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f,
+};
+static const float example_return_velocity[] = {
+    -0.00000f, -1.20000f, -2.40000f, -3.60000f, -4.80000f, -6.00000f, -7.20000f, -8.40000f, -9.60000f, -10.80000f,
+    -12.00000f, -13.20000f, -14.40000f, -15.60000f, -16.80000f, -18.00000f, -19.20000f, -20.40000f, -21.60000f, -22.80000f,
+    -24.00000f, -25.20000f, -26.40000f, -27.60000f, -28.80000f, -30.00000f, -31.20000f, -32.40000f, -33.60000f, -34.80000f,
+    -36.00000f, -37.20000f, -38.40000f, -39.60000f, -39.94144f, -39.33778f, -38.78436f, -38.28439f, -37.84101f, -37.45713f,
+    -37.13532f, -36.87780f, -36.68635f, -36.56227f, -36.50633f, -36.51874f, -36.59918f, -36.74677f, -36.96009f, -37.23716f,
+    -37.57547f, -37.97203f, -38.42347f, -38.92591f, -39.47529f, -40.06723f, -40.69728f, -41.36100f, -42.05401f, -42.77215f,
+    -43.51163f, -44.26905f, -45.04157f, -45.82696f, -46.62367f, -47.43093f, -48.24877f, -49.07812f, -49.92085f, -50.77986f,
+    -51.65920f, -52.56421f, -53.50171f, -54.48024f, -54.50336f, -53.52376f, -52.58543f, -51.67975f, -50.79987f, -49.94044f,
+    -49.09738f, -48.26775f, -47.44965f, -46.64216f, -45.84520f, -45.05954f, -44.28669f, -43.52889f, -42.78897f, -42.07028f,
+    -41.37666f, -40.71222f, -40.08133f, -39.48846f, -38.93807f, -38.43449f, -37.98185f, -37.58395f, -37.24426f, -36.96576f,
+    -36.75094f, -36.60181f, -36.51980f, -36.50584f, -36.56023f, -36.68275f, -36.87265f, -37.12865f, -37.44899f, -37.83147f,
+    -38.27351f, -38.77221f, -39.32444f, -39.92700f, -40.57669f, -41.27053f, -42.00590f, -42.78074f, -43.59381f, -44.44493f,
+    -45.33533f, -46.26804f, -47.24846f, -48.28495f, -49.38998f, -50.57309f, -51.77309f, -52.97309f, -54.17309f, -55.00000f,
+    -55.00000f, -55.00000f, -55.00000f, -55.00000f, -55.00000f, -55.00000f, -55.00000f, -55.00000f, -55.00000f, -55.00000f,
+    -55.00000f, -55.00000f, -55.00000f, -55.00000f, -55.00000f, -55.00000f, -55.00000f, -55.00000f, -55.00000f, -54.68728f,
+    -53.48729f, -52.28728f, -51.08728f, -49.88728f, -48.68728f, -47.48729f, -46.28728f, -45.08728f, -43.88728f, -42.68728f,
+    -41.48729f, -40.28728f, -39.08728f, -37.88728f, -36.68728f, -35.48729f, -34.28728f, -33.08728f, -31.88728f, -30.68728f,
+    -29.48728f, -28.28728f, -27.08728f, -25.88728f, -24.68728f, -23.48728f, -22.28728f, -21.08728f, -19.88728f, -18.68728f,
+    -17.48728f, -16.28728f, -15.08728f, -13.88728f, -12.68728f, -11.48728f, -10.28728f, -9.08728f, -7.88728f, -6.68728f,
+    -5.48728f, -4.28728f, -3.08728f, -1.88728f, -0.68728f, -0.00000f,
+};
+static const float example_return_curvature[] = {
+    0.00000f, 0.00013f, 0.00026f, 0.00056f, 0.00099f, 0.00153f, 0.00220f, 0.00298f, 0.00387f, 0.00487f,
+    0.00598f, 0.00720f, 0.00852f, 0.00994f, 0.01146f, 0.01308f, 0.01480f, 0.01661f, 0.01853f, 0.02055f,
+    0.02267f, 0.02490f, 0.02725f, 0.02971f, 0.03230f, 0.03502f, 0.03788f, 0.04087f, 0.04401f, 0.04730f,
+    0.05073f, 0.05429f, 0.05798f, 0.06175f, 0.06557f, 0.06924f, 0.07271f, 0.07593f, 0.07886f, 0.08145f,
+    0.08366f, 0.08546f, 0.08682f, 0.08770f, 0.08810f, 0.08801f, 0.08744f, 0.08639f, 0.08489f, 0.08296f,
+    0.08065f, 0.07799f, 0.07503f, 0.07182f, 0.06840f, 0.06482f, 0.06112f, 0.05735f, 0.05354f, 0.04972f,
+    0.04592f, 0.04216f, 0.03845f, 0.03481f, 0.03124f, 0.02775f, 0.02433f, 0.02098f, 0.01769f, 0.01445f,
+    0.01125f, 0.00806f, 0.00487f, 0.00166f, -0.00158f, -0.00480f, -0.00799f, -0.01117f, -0.01438f, -0.01762f,
+    -0.02091f, -0.02426f, -0.02767f, -0.03116f, -0.03473f, -0.03837f, -0.04207f, -0.04583f, -0.04963f, -0.05345f,
+    -0.05726f, -0.06103f, -0.06473f, -0.06832f, -0.07174f, -0.07496f, -0.07792f, -0.08059f, -0.08291f, -0.08485f,
+    -0.08636f, -0.08742f, -0.08801f, -0.08811f, -0.08772f, -0.08684f, -0.08550f, -0.08371f, -0.08151f, -0.07892f,
+    -0.07600f, -0.07279f, -0.06933f, -0.06565f, -0.06182f, -0.05786f, -0.05380f, -0.04967f, -0.04550f, -0.04130f,
+    -0.03708f, -0.03282f, -0.02853f, -0.02419f, -0.01975f, -0.01519f, -0.01044f, -0.00544f, -0.00008f, 0.00000f,
+    0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f,
+    0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f, 0.00000f,
+    -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f,
+    -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f,
+    -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f,
+    -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f,
+    -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f, -0.00000f,
+};
+static const float example_return_distance[] = {
+    0.00000f, 0.01248f, 0.02496f, 0.05421f, 0.09638f, 0.15020f, 0.21617f, 0.29412f, 0.38407f, 0.48607f,
+    0.60003f, 0.72600f, 0.86404f, 1.01402f, 1.17603f, 1.35001f, 1.53602f, 1.73400f, 1.94401f, 2.16601f,
+    2.40000f, 2.64601f, 2.90401f, 3.17401f, 3.45601f, 3.75001f, 4.05600f, 4.37401f, 4.70401f, 5.04601f,
+    5.40000f, 5.76601f, 6.14400f, 6.53400f, 6.93399f, 7.33034f, 7.72091f, 8.10621f, 8.48679f, 8.86323f,
+    9.23614f, 9.60615f, 9.97392f, 10.34010f, 10.70539f, 11.07046f, 11.43599f, 11.80266f, 12.17115f, 12.54208f,
+    12.91609f, 13.29378f, 13.67572f, 14.06242f, 14.45439f, 14.85207f, 15.25586f, 15.66613f, 16.08318f, 16.50729f,
+    16.93870f, 17.37758f, 17.82413f, 18.27846f, 18.74070f, 19.21097f, 19.68936f, 20.17598f, 20.67096f, 21.17445f,
+    21.68663f, 22.20772f, 22.73802f, 23.27789f, 23.82533f, 24.36543f, 24.89595f, 25.41725f, 25.92963f, 26.43332f,
+    26.92849f, 27.41531f, 27.89389f, 28.36433f, 28.82676f, 29.28128f, 29.72799f, 30.16706f, 30.59863f, 31.02291f,
+    31.44012f, 31.85054f, 32.25448f, 32.65229f, 33.04439f, 33.43121f, 33.81325f, 34.19103f, 34.56512f, 34.93612f,
+    35.30465f, 35.67136f, 36.03691f, 36.40199f, 36.76726f, 37.13342f, 37.50114f, 37.87109f, 38.24392f, 38.62028f,
+    39.00075f, 39.38594f, 39.77638f, 40.17260f, 40.57507f, 40.98428f, 41.40062f, 41.82452f, 42.25637f, 42.69653f,
+    43.14540f, 43.60337f, 44.07092f, 44.54853f, 45.03684f, 45.53660f, 46.04834f, 46.57207f, 47.10780f, 47.65495f,
+    48.20494f, 48.75495f, 49.30495f, 49.85495f, 50.40495f, 50.95494f, 51.50495f, 52.05495f, 52.60495f, 53.15495f,
+    53.70494f, 54.25495f, 54.80495f, 55.35495f, 55.90495f, 56.45494f, 57.00495f, 57.55495f, 58.10495f, 58.65454f,
+    59.19541f, 59.72429f, 60.24116f, 60.74603f, 61.23890f, 61.71978f, 62.18865f, 62.64552f, 63.09039f, 63.52327f,
+    63.94414f, 64.35301f, 64.74989f, 65.13476f, 65.50763f, 65.86850f, 66.21738f, 66.55425f, 66.87912f, 67.19199f,
+    67.49287f, 67.78174f, 68.05861f, 68.32349f, 68.57635f, 68.81723f, 69.04610f, 69.26297f, 69.46785f, 69.66071f,
+    69.84159f, 70.01047f, 70.16734f, 70.31221f, 70.44507f, 70.56595f, 70.67480f, 70.77169f, 70.85658f, 70.92944f,
+    70.99024f, 71.03905f, 71.07582f, 71.10085f, 71.11046f, 71.11578f,
+};
+const PathProfile path_example_return = {"example_return", 196, 0.010f, true, example_return_x, example_return_y, example_return_theta, example_return_velocity, example_return_curvature, example_return_distance};
+
+const PathProfile* const PATHS[PATH_COUNT] = {&path_example_curve, &path_example_return};
@@ -0,0 +1,130 @@
+#include "main.h"
+
+using namespace ez;
+
+// Feedforward constants and gain schedules live here instead of in PID, firmware/EZ-Template.a
+// was built against PID's current layout (and Drive's, which holds PIDs) so it can't grow any
+// members.  Entries are looked up by the PID they belong to, a Drive has 9 PIDs
+namespace {
+constexpr int EXTRAS_MAX = 24;
+constexpr int SCHEDULE_MAX = 6;
+
+struct PidExtras {
+  const PID* pid = nullptr;
+  PID::Feedforward feedforward;
+
+  // Sorted by at
+  PID::ScheduleKey key = PID::SCHEDULE_ERROR;
+  PID::GainPoint schedule[SCHEDULE_MAX];
+  int schedule_count = 0;
+  bool schedule_enabled = true;
+
+  // constants_set()'s gains, put back when the schedule is turned off or removed.  applied is
+  // what the schedule last wrote, if constants don't match it someone set new ones since
+  PID::Constants base = {};
+  PID::Constants applied = {};
+  bool applying = false;
+};
+
+PidExtras extras[EXTRAS_MAX];
+}  // namespace
+
+static bool gains_equal(const PID::Constants& a, const PID::Constants& b) { return a.kp == b.kp && a.ki == b.ki && a.kd == b.kd; }
+
+// Gives constants back to constants_set(), unless it was called while the schedule was running
+static void schedule_release(PidExtras* entry, PID::Constants& constants) {
+  if (!entry->applying) return;
+  if (gains_equal(constants, entry->applied)) {
+    constants.kp = entry->base.kp;
+    constants.ki = entry->base.ki;
+    constants.kd = entry->base.kd;
+  }
+  entry->applying = false;
+}
+
+// The entry for a PID, or nullptr if it has none and create is false
+static PidExtras* extras_get(const PID* pid, bool create) {
+  for (auto& entry : extras) {
+    if (entry.pid == pid) return &entry;
+  }
+  if (!create) return nullptr;
+  for (auto& entry : extras) {
+    if (!entry.pid) {
+      entry.pid = pid;
+      return &entry;
+    }
+  }
+  printf("Too many PIDs with feedforward or gain schedules (%d), ignoring this one\n", EXTRAS_MAX);
+  return nullptr;
+}
+
+void PID::feedforward_set(double kS, double kV, double kA) {
+  PidExtras* entry = extras_get(this, true);
+  if (entry) entry->feedforward = {kS, kV, kA};
+}
+
+PID::Feedforward PID::feedforward_get() {
+  PidExtras* entry = extras_get(this, false);
+  return entry ? entry->feedforward : Feedforward();
+}
+
+double PID::feedforward_compute(double velocity, double acceleration) {
+  PidExtras* entry = extras_get(this, false);
+  if (!entry) return 0;
+  const Feedforward& ff = entry->feedforward;
+  return ff.kS * util::sgn(velocity) + ff.kV * velocity + ff.kA * acceleration;
+}
+
+void PID::gains_schedule_set(ScheduleKey key, std::initializer_list<GainPoint> points) {
+  PidExtras* entry = extras_get(this, points.size() > 0);
+  if (!entry) return;
+  if (points.size() == 0) schedule_release(entry, constants);
+  if (!entry->applying) entry->base = constants;
+  if (points.size() > SCHEDULE_MAX) printf("Gain schedules have at most %d rows, ignoring the rest\n", SCHEDULE_MAX);
+
+  entry->key = key;
+  entry->schedule_enabled = true;
+  entry->schedule_count = 0;
+  for (const GainPoint& point : points) {
+    if (entry->schedule_count == SCHEDULE_MAX) break;
+    // Insertion sort, there are only a few rows
+    int i = entry->schedule_count++;
+    for (; i > 0 && entry->schedule[i - 1].at > point.at; i--) entry->schedule[i] = entry->schedule[i - 1];
+    entry->schedule[i] = point;
+  }
+}
+
+bool PID::gains_scheduled() {
+  PidExtras* entry = extras_get(this, false);
+  return entry && entry->schedule_enabled && entry->schedule_count > 0;
+}
+
+void PID::gains_schedule_toggle(bool enabled) {
+  PidExtras* entry = extras_get(this, false);
+  if (!entry) return;
+  if (!enabled) schedule_release(entry, constants);
+  entry->schedule_enabled = enabled;
+}
+
+void PID::gains_schedule_update(double error, double speed) {
+  PidExtras* entry = extras_get(this, false);
+  if (!entry || !entry->schedule_enabled || entry->schedule_count == 0) return;
+  const GainPoint* rows = entry->schedule;
+  int count = entry->schedule_count;
+  double input = entry->key == SCHEDULE_ERROR ? fabs(error) : fabs(speed);
+
+  // Counting the rows at or below input finds the segment without a branch per row
+  int low = 0;
+  for (int i = 1; i < count; i++) low += input >= rows[i].at;
+  const GainPoint& a = rows[low];
+  const GainPoint& b = rows[low + 1 < count ? low + 1 : low];
+  double span = b.at - a.at;
+  double f = span > 0 ? util::clamp((input - a.at) / span, 1.0, 0.0) : 0.0;
+
+  if (!entry->applying || !gains_equal(constants, entry->applied)) entry->base = constants;
+  constants.kp = a.kp + (b.kp - a.kp) * f;
+  constants.ki = a.ki + (b.ki - a.ki) * f;
+  constants.kd = a.kd + (b.kd - a.kd) * f;
+  entry->applied = constants;
+  entry->applying = true;
+}
@@ -0,0 +1,206 @@
+#include <atomic>
+#include <cmath>
+
+#include "main.h"
+#include "path_profile.hpp"
+
+using namespace ez;
+
+namespace {
+// Closer than this the heading stops chasing the point, so the robot doesn't spin as it passes it
+constexpr double POSE_SETTLE_DISTANCE = 6.0;
+
+// How far along a path the robot steers at, and how far ahead (in points) the closest point is looked for
+constexpr double PATH_LOOKAHEAD = 8.0;
+constexpr std::uint32_t PATH_SEARCH_POINTS = 25;
+
+// The speed cap follows the profile this many points (10ms each) ahead, so it leads the motors
+constexpr std::uint32_t PATH_SPEED_LEAD = 10;
+
+// Slowest the speed cap gets, as a fraction of speed, or the robot never leaves the first point
+constexpr double PATH_SPEED_MIN = 0.2;
+
+// The pid_drive_to_point / pid_drive_to_pose being followed.  Written by the caller before
+// active is set, then only read by the drive task
+struct PoseFollow {
+  std::atomic<bool> active{false};
+  pose target;
+  bool use_heading;
+  bool backwards;
+  double lead;
+
+  // Set for pid_path_set, index only moves forward
+  const PathProfile* path;
+  std::uint32_t index;
+  double peak_velocity;
+  int speed;
+
+  // Targets this last wrote, anything else means a new motion replaced it
+  double left_target;
+  double right_target;
+};
+
+PoseFollow follow;
+}  // namespace
+
+// -180 to 180
+static double angle_wrap(double angle) {
+  angle = fmod(angle + 180.0, 360.0);
+  if (angle < 0) angle += 360.0;
+  return angle - 180.0;
+}
+
+static double to_deg(double rad) { return rad * 180.0 / M_PI; }
+static double to_rad(double deg) { return deg * M_PI / 180.0; }
+
+// Angle from the robot to a point, in the same clockwise degrees as the pose
+static double angle_to(pose current, double x, double y) { return to_deg(atan2(x - current.x, y - current.y)); }
+
+void Drive::pid_turn_to_point(double x, double y, int speed, bool slew_on) {
+  follow.active = false;
+  pose current = odom_pose_get();
+  // Odometry and the IMU can disagree after drive_angle_set(), so turn relative to the IMU
+  double turn = angle_wrap(angle_to(current, x, y) - current.theta);
+  pid_turn_set(drive_imu_get() + turn, speed, slew_on);
+}
+
+static void pose_follow_start(Drive& drive, pose target, int speed, double lead, bool slew_on, bool use_heading) {
+  follow.active = false;
+  pose current = drive.odom_pose_get();
+  double distance = hypot(target.x - current.x, target.y - current.y);
+  double error = angle_wrap(angle_to(current, target.x, target.y) - current.theta);
+  bool backwards = fabs(error) > 90.0;
+  double facing = backwards ? angle_wrap(error + 180.0) : error;
+
+  drive.headingPID.target_set(drive.drive_imu_get() + facing);
+  drive.pid_drive_set(distance * cos(to_rad(error)), speed, slew_on, true);
+
+  follow.target = target;
+  follow.use_heading = use_heading;
+  follow.backwards = backwards;
+  follow.lead = lead;
+  follow.path = nullptr;
+  follow.left_target = drive.leftPID.target_get();
+  follow.right_target = drive.rightPID.target_get();
+  follow.active = true;
+}
+
+void Drive::pid_drive_to_point(double x, double y, int speed, bool slew_on) { pose_follow_start(*this, {x, y, 0}, speed, 0, slew_on, false); }
+
+void Drive::pid_drive_to_pose(pose target, int speed, double lead, bool slew_on) { pose_follow_start(*this, target, speed, lead, slew_on, true); }
+
+void Drive::pid_path_set(const PathProfile& path, int speed, bool slew_on) {
+  // A path file can say it has no points, there's no end to drive to
+  if (path.count == 0) {
+    printf("pid_path_set: %s has no points, not moving\n", path.name ? path.name : "path");
+    return;
+  }
+  follow.active = false;
+  PathPoint start = path.point(0);
+  PathPoint end = path.point(path.count - 1);
+  double peak = 0;
+  for (std::uint32_t i = 0; i < path.count; i++) peak = fmax(peak, fabs(path.velocity[i]));
+
+  headingPID.target_set(drive_imu_get() + angle_wrap(start.theta - odom_pose_get().theta));
+  pid_drive_set(path.reversed ? -end.distance : end.distance, speed, slew_on, true);
+
+  follow.target = {end.x, end.y, end.theta};
+  follow.use_heading = true;
+  follow.backwards = path.reversed;
+  follow.lead = 0;
+  follow.path = &path;
+  follow.index = 0;
+  follow.peak_velocity = peak > 0 ? peak : 1;
+  follow.speed = speed;
+  follow.left_target = leftPID.target_get();
+  follow.right_target = rightPID.target_get();
+  follow.active = true;
+}
+
+// Steers along a path and returns what's left of it.  Within PATH_LOOKAHEAD of the end this sets
+// finishing instead, and the end is driven to like pid_drive_to_pose
+static double path_step(Drive& drive, pose current, bool& finishing) {
+  const PathProfile& path = *follow.path;
+  std::uint32_t last = path.count - 1;
+
+  // Closest point, only looking forward so a path that crosses itself doesn't jump back
+  std::uint32_t index = follow.index;
+  double closest = hypot(path.x[index] - current.x, path.y[index] - current.y);
+  for (std::uint32_t i = follow.index + 1; i <= last && i <= follow.index + PATH_SEARCH_POINTS; i++) {
+    double distance = hypot(path.x[i] - current.x, path.y[i] - current.y);
+    if (distance < closest) {
+      closest = distance;
+      index = i;
+    }
+  }
+  follow.index = index;
+
+  // Cap the speed to the profile, unless slew is still ramping up
+  double velocity = fabs(path.velocity[std::min(index + PATH_SPEED_LEAD, last)]);
+  double cap = follow.speed * fmax(velocity / follow.peak_velocity, PATH_SPEED_MIN);
+  if (!drive.slew_left.enabled()) drive.slew_left.initialize(false, cap, follow.left_target, drive.drive_sensor_left());
+  if (!drive.slew_right.enabled()) drive.slew_right.initialize(false, cap, follow.right_target, drive.drive_sensor_right());
+
+  std::uint32_t aim = index;
+  while (aim < last && path.distance[aim] < path.distance[index] + PATH_LOOKAHEAD) aim++;
+  finishing = aim == last;
+  if (finishing) return 0;
+
+  double facing = angle_to(current, path.x[aim], path.y[aim]) + (follow.backwards ? 180.0 : 0.0);
+  drive.headingPID.target_set(drive.drive_imu_get() + angle_wrap(facing - current.theta));
+  // Along the path from the closest point, less however far the robot is past it.  This keeps the
+  // error moving with the robot between points, so the velocity exit only fires when it's stopped
+  PathPoint here = path.point(index);
+  double travel = to_rad(here.theta + (follow.backwards ? 180.0 : 0.0));
+  double past = (current.x - here.x) * sin(travel) + (current.y - here.y) * cos(travel);
+  double remaining = path.distance[last] - here.distance - past;
+  return follow.backwards ? -remaining : remaining;
+}
+
+void Drive::pid_pose_step() {
+  if (!follow.active) return;
+  if (drive_mode_get() != DRIVE || leftPID.target_get() != follow.left_target || rightPID.target_get() != follow.right_target) {
+    follow.active = false;
+    return;
+  }
+
+  if (follow.path) {
+    bool finishing;
+    double remaining = path_step(*this, odom_pose_get(), finishing);
+    if (!finishing) {
+      follow.left_target = drive_sensor_left() + remaining;
+      follow.right_target = drive_sensor_right() + remaining;
+      leftPID.target_set(follow.left_target);
+      rightPID.target_set(follow.right_target);
+      return;
+    }
+  }
+
+  pose current = odom_pose_get();
+  pose target = follow.target;
+  double distance = hypot(target.x - current.x, target.y - current.y);
+
+  // Boomerang carrot, behind the target along its heading (in front of it when backing in)
+  double aim_x = target.x;
+  double aim_y = target.y;
+  if (follow.use_heading) {
+    double pull = follow.lead * distance * (follow.backwards ? -1.0 : 1.0);
+    aim_x -= pull * sin(to_rad(target.theta));
+    aim_y -= pull * cos(to_rad(target.theta));
+  }
+
+  double imu = drive_imu_get();
+  if (distance > POSE_SETTLE_DISTANCE) {
+    double facing = angle_to(current, aim_x, aim_y) + (follow.backwards ? 180.0 : 0.0);
+    headingPID.target_set(imu + angle_wrap(facing - current.theta));
+  } else if (follow.use_heading) {
+    headingPID.target_set(imu + angle_wrap(target.theta - current.theta));
+  }
+
+  // Whatever is left, along the way the robot is facing.  Past the point this goes negative
+  double remaining = distance * cos(to_rad(angle_to(current, target.x, target.y) - current.theta));
+  follow.left_target = drive_sensor_left() + remaining;
+  follow.right_target = drive_sensor_right() + remaining;
+  leftPID.target_set(follow.left_target);
+  rightPID.target_set(follow.right_target);
+}
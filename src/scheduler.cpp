@@ -0,0 +1,104 @@
+#include "scheduler.hpp"
+
+#include "pros/rtos.h"
+#include "task_profiler.hpp"
+
+ControlScheduler scheduler;
+
+static std::uint32_t pros_millis() { return pros::c::millis(); }
+static std::uint64_t pros_micros() { return pros::c::micros(); }
+static void pros_delay_until(std::uint32_t* prev_time, std::uint32_t delta) { pros::c::task_delay_until(prev_time, delta); }
+
+SchedulerClock scheduler_pros_clock() { return {pros_millis, pros_micros, pros_delay_until}; }
+
+ControlScheduler::ControlScheduler(int tick_ms, SchedulerClock clock) : clock(clock), tick_ms(tick_ms > 0 ? tick_ms : 1) {}
+
+int ControlScheduler::add(std::string name, std::function<void()> callback, int period_ms) {
+  Entry entry;
+  entry.name = name;
+  entry.callback = callback;
+  entry.divider = period_ms <= tick_ms ? 1 : (period_ms + tick_ms / 2) / tick_ms;
+  entries.push_back(entry);
+  return entries.size() - 1;
+}
+
+void ControlScheduler::clear() {
+  entries.clear();
+  tick_count = 0;
+}
+
+void ControlScheduler::tick() {
+  // The schedule starts from the first tick, not the first wait, or the first period is long by its exec time
+  if (!started) {
+    wake_time = clock.millis();
+    started = true;
+  }
+  for (auto &entry : entries) {
+    if (tick_count % entry.divider != 0) continue;
+
+    std::uint64_t start = clock.micros();
+    entry.callback();
+    std::uint64_t end = clock.micros();
+
+    Stats &s = entry.stats;
+    if (s.runs > 0) {
+      s.period = start - entry.last_start;
+      s.period_max = std::max(s.period, s.period_max);
+    }
+    entry.last_start = start;
+    s.exec = end - start;
+    s.exec_max = std::max(s.exec, s.exec_max);
+    if (s.exec > (std::uint32_t)(entry.divider * tick_ms * 1000)) s.overruns++;
+    s.runs++;
+  }
+  tick_count++;
+}
+
+void ControlScheduler::wait() {
+  std::uint32_t now = clock.millis();
+  // The next deadline already passed, so drop the missed ticks instead of running them back to back
+  if ((std::int32_t)(now - wake_time) >= tick_ms) {
+    late_ticks++;
+    wake_time = now;
+  }
+  clock.delay_until(&wake_time, tick_ms);
+}
+
+void ControlScheduler::run() {
+  TaskProfile* profile = profiler.add("opcontrol", tick_ms);
+  started = false;
+  while (true) {
+    {
+      TaskProfile::Scope cycle(profile);
+      tick();
+    }
+    wait();
+  }
+}
+
+int ControlScheduler::size() { return entries.size(); }
+
+ControlScheduler::Stats ControlScheduler::stats_get(int id) { return entries[id].stats; }
+
+std::string ControlScheduler::name_get(int id) { return entries[id].name; }
+
+std::uint32_t ControlScheduler::late_ticks_get() { return late_ticks; }
+
+int ControlScheduler::tick_ms_get() { return tick_ms; }
+
+void ControlScheduler::stats_reset() {
+  for (auto &entry : entries) {
+    entry.stats = Stats();
+  }
+  late_ticks = 0;
+}
+
+void ControlScheduler::stats_print() {
+  printf("\n%-16s %8s %8s %10s %10s %10s %10s\n", "callback", "runs", "overrun", "period", "period max", "exec", "exec max");
+  for (auto &entry : entries) {
+    Stats &s = entry.stats;
+    printf("%-16s %8lu %8lu %10lu %10lu %10lu %10lu\n", entry.name.c_str(), (unsigned long)s.runs, (unsigned long)s.overruns,
+           (unsigned long)s.period, (unsigned long)s.period_max, (unsigned long)s.exec, (unsigned long)s.exec_max);
+  }
+  printf("late ticks: %lu\n", (unsigned long)late_ticks);
+}
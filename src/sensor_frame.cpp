@@ -0,0 +1,43 @@
+#include "sensor_frame.hpp"
+
+#include "main.h"
+
+SensorFrameService sensors;
+
+void SensorFrameService::update() {
+  std::uint64_t start = pros::c::micros();
+
+  // Write into the buffer readers aren't using, then publish it with one store
+  std::uint32_t back = (published.load(std::memory_order_relaxed) + 1) & 1;
+  SensorFrame& frame = frames[back];
+
+  pros::Motor& left = chassis.left_motors.front();
+  pros::Motor& right = chassis.right_motors.front();
+  // The device's time, not when this copied it, a reading can be a few ms old by now
+  if (left.get_raw_position(&frame.time) == PROS_ERR) frame.time = pros::millis();
+  frame.left_velocity = left.get_actual_velocity();
+  frame.right_velocity = right.get_actual_velocity();
+  frame.left_current = left.get_current_draw();
+  frame.right_current = right.get_current_draw();
+
+  frame.heading = chassis.drive_heading_get();  // Already fused on the odometry task, not a device call
+  frame.gyro_z = chassis.imu.get_gyro_rate().z;
+
+  frame.seq = ++seq;
+  published.store(back, std::memory_order_release);
+
+  exec = pros::c::micros() - start;
+}
+
+SensorFrame SensorFrameService::get() {
+  // If update() lands mid copy the buffer changes under us, so check the seq and retry
+  SensorFrame copy;
+  do {
+    copy = frames[published.load(std::memory_order_acquire)];
+  } while (copy.seq != frames[published.load(std::memory_order_acquire)].seq);
+  return copy;
+}
+
+const SensorFrame& SensorFrameService::latest() { return frames[published.load(std::memory_order_acquire)]; }
+
+std::uint32_t SensorFrameService::exec_get() { return exec; }
@@ -0,0 +1,82 @@
+#include "startup.hpp"
+
+#include "main.h"
+
+Startup startup;
+
+int Startup::add(const char* name, std::function<void()> callback, int after) {
+  if (stage_count == MAX_STAGES) {
+    printf("Too many startup stages (%d), running %s now\n", MAX_STAGES, name);
+    callback();
+    return -1;
+  }
+  Stage& stage = stages[stage_count];
+  stage.startup = this;
+  stage.name = name;
+  stage.callback = callback;
+  stage.after = after >= 0 && after < stage_count ? after : -1;
+  stage.start = 0;
+  stage.end = 0;
+  stage.done = false;
+  remaining++;
+  return stage_count++;
+}
+
+void Startup::task_function(void* parameter) {
+  Stage* stage = static_cast<Stage*>(parameter);
+  Startup* startup = stage->startup;
+  if (stage->after >= 0) {
+    while (!startup->stages[stage->after].done.load(std::memory_order_acquire)) pros::delay(ez::util::DELAY_TIME);
+  }
+
+  stage->start = pros::millis();
+  timeline.begin(stage->name);
+  stage->callback();
+  timeline.end(stage->name);
+  stage->end = pros::millis();
+  printf("Startup: %s took %lu ms\n", stage->name, (unsigned long)(stage->end - stage->start));
+  stage->done.store(true, std::memory_order_release);
+
+  if (startup->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    startup->ready_time = stage->end;
+    timeline.mark("ready");
+    printf("Startup: ready %lu ms after boot\n", (unsigned long)stage->end);
+  }
+}
+
+void Startup::start() {
+  for (int i = 0; i < stage_count; i++)
+    pros::c::task_create(task_function, &stages[i], TASK_PRIORITY_DEFAULT, TASK_STACK_DEPTH_DEFAULT, stages[i].name);
+}
+
+bool Startup::ready() { return remaining.load(std::memory_order_acquire) == 0; }
+
+bool Startup::wait(int timeout_ms) {
+  std::uint32_t start = pros::millis();
+  while (!ready()) {
+    if ((int)(pros::millis() - start) >= timeout_ms) {
+      printf("Startup: gave up after %d ms waiting on", timeout_ms);
+      for (int i = 0; i < stage_count; i++)
+        if (!stages[i].done.load(std::memory_order_acquire)) printf(" %s", stages[i].name);
+      printf("\n");
+      return false;
+    }
+    pros::delay(ez::util::DELAY_TIME);
+  }
+  return true;
+}
+
+std::uint32_t Startup::ready_time_get() { return ready_time; }
+
+void Startup::print() {
+  printf("Startup: stage, started at ms, took ms\n");
+  for (int i = 0; i < stage_count; i++) {
+    const Stage& stage = stages[i];
+    printf("  %-10s %5lu  ", stage.name, (unsigned long)stage.start);
+    if (stage.done.load(std::memory_order_acquire))
+      printf("%lu\n", (unsigned long)(stage.end - stage.start));
+    else
+      printf("running\n");
+  }
+  if (ready()) printf("  ready at %lu ms\n", (unsigned long)ready_time.load());
+}
@@ -13,55 +13,84 @@ pros::ADIDigitalOut PTO('B');
 pros::ADIDigitalOut ClimbRelease('A');
 pros::ADIDigitalOut Scooper('C');
 
-pros::Motor_Group Intake({Intake1, Intake2});
-
 bool climberLock = false;
 bool ptoState = false;
 bool WingState = false;
 
-void setIntake(int speed) { Intake.move_voltage(speed * 120); }
+// Driver control only stages outputs, the scheduler flushes them once a tick.  Autons call
+// these directly, so they flush right away
+static void intakeStage(int speed) {
+  commands.motor_set(Intake1, speed * 120);
+  commands.motor_set(Intake2, speed * 120);
+}
 
-void wingControl(bool state) { wingActuation.set_value(state); }
+// Puts every output in the command buffer at its starting state, so the first control tick
+// doesn't have to add them
+void subsystemsInitialize() {
+  intakeStage(0);
+  commands.digital_set(wingActuation, WingState);
+  commands.digital_set(PTO, ptoState);
+  commands.digital_set(ClimbRelease, climberLock);
+  commands.digital_set(Scooper, false);
+  commands.flush();
+}
 
-void scooperControl(bool state){ Scooper.set_value(state); }
+void setIntake(int speed) {
+  intakeStage(speed);
+  commands.flush();
+}
 
-void ptoControl(bool state) { PTO.set_value(state); }
+void wingControl(bool state) {
+  commands.digital_set(wingActuation, state);
+  commands.flush();
+}
+
+void scooperControl(bool state) {
+  commands.digital_set(Scooper, state);
+  commands.flush();
+}
+
+void ptoControl(bool state) {
+  commands.digital_set(PTO, state);
+  commands.flush();
+}
 
 
 void intakeControl() {
-  setIntake((master.get_digital(pros::E_CONTROLLER_DIGITAL_R1) -
-             master.get_digital(pros::E_CONTROLLER_DIGITAL_R2)) *
-            100);
+  const ControllerFrame& input = inputs.latest();
+  intakeStage((input.held(pros::E_CONTROLLER_DIGITAL_R1) -
+               input.held(pros::E_CONTROLLER_DIGITAL_R2)) *
+              100);
 }
 
 void scooperTeleControl() {
-    scooperControl(master.get_digital(pros::E_CONTROLLER_DIGITAL_L1));
+    commands.digital_set(Scooper, inputs.latest().held(pros::E_CONTROLLER_DIGITAL_L1));
   }
 
 void wingTeleControl(){
 
-wingControl(master.get_digital(pros::E_CONTROLLER_DIGITAL_L2));
+commands.digital_set(wingActuation, inputs.latest().held(pros::E_CONTROLLER_DIGITAL_L2));
 }
 void ptoTeleControl(){
-  if(master.get_digital_new_press(pros::E_CONTROLLER_DIGITAL_B)){
+  if(inputs.latest().new_press(pros::E_CONTROLLER_DIGITAL_B)){
     ptoState = !ptoState;
   }
 
-  PTO.set_value(ptoState);
+  commands.digital_set(PTO, ptoState);
 }
 
 void wingTeleControl2(){
-  if(master.get_digital_new_press(pros::E_CONTROLLER_DIGITAL_L2)){
+  if(inputs.latest().new_press(pros::E_CONTROLLER_DIGITAL_L2)){
     WingState = !WingState;
   }
 
-  wingActuation.set_value(WingState);
+  commands.digital_set(wingActuation, WingState);
 }
 
 void climbReleaseTeleRelease(){
-    if(master.get_digital_new_press(pros::E_CONTROLLER_DIGITAL_DOWN)){
+    if(inputs.latest().new_press(pros::E_CONTROLLER_DIGITAL_DOWN)){
     climberLock = !climberLock;
   }
 
-  ClimbRelease.set_value(climberLock);
+  commands.digital_set(ClimbRelease, climberLock);
 }
\ No newline at end of file
@@ -0,0 +1,162 @@
+#include "task_profiler.hpp"
+
+#include <cstring>
+
+#include "main.h"
+
+Profiler profiler;
+
+std::atomic<bool> TaskProfile::active{false};
+
+namespace {
+// Tasks add their profiles whenever they start, this keeps two from taking the same slot
+pros::Mutex add_mutex;
+
+// One RTOS tick, a delay_until loop can wake this late without anything being wrong
+constexpr std::uint32_t DEADLINE_SLACK = 1000;
+}  // namespace
+
+int TaskProfile::bucket(std::uint32_t us) {
+  for (int i = 0; i < BUCKETS - 1; i++)
+    if (us <= BUCKET_EDGES[i]) return i;
+  return BUCKETS - 1;
+}
+
+void TaskProfile::begin() {
+  start = pros::c::micros();
+  if (last_start != 0) {
+    std::uint32_t period = start - last_start;
+    period_counts[bucket(period)]++;
+    period_max = std::max(period, period_max);
+    if (period > period_us + DEADLINE_SLACK) misses++;
+  }
+  last_start = start;
+}
+
+void TaskProfile::end() {
+  std::uint32_t exec = pros::c::micros() - start;
+  exec_counts[bucket(exec)]++;
+  exec_max = std::max(exec, exec_max);
+  if (exec > period_us) misses++;
+  cycles++;
+}
+
+void TaskProfile::restart() { last_start = 0; }
+
+const char* TaskProfile::name_get() { return name; }
+
+std::uint32_t TaskProfile::cycles_get() { return cycles; }
+
+std::uint32_t TaskProfile::misses_get() { return misses; }
+
+std::uint32_t TaskProfile::percentile(const std::uint32_t (&counts)[BUCKETS], std::uint32_t max, double fraction) {
+  std::uint32_t total = 0;
+  for (auto count : counts) total += count;
+  if (total == 0) return 0;
+
+  std::uint32_t target = ceil(total * util::clamp(fraction, 1.0, 0.0));
+  std::uint32_t seen = 0;
+  for (int i = 0; i < BUCKETS - 1; i++) {
+    seen += counts[i];
+    if (seen >= target && seen > 0) return std::min(BUCKET_EDGES[i], max);
+  }
+  return max;
+}
+
+std::uint32_t TaskProfile::period_percentile_get(double fraction) { return percentile(period_counts, period_max, fraction); }
+
+std::uint32_t TaskProfile::exec_percentile_get(double fraction) { return percentile(exec_counts, exec_max, fraction); }
+
+// A loop that's running could be halfway through a cycle, so this just puts up with one odd sample
+void TaskProfile::reset() {
+  cycles = 0;
+  misses = 0;
+  for (int i = 0; i < BUCKETS; i++) {
+    period_counts[i] = 0;
+    exec_counts[i] = 0;
+  }
+  period_max = 0;
+  exec_max = 0;
+  restart();
+}
+
+void TaskProfile::print() {
+  printf("\n%s, %lu cycles every %lu ms, %lu missed\n", name, (unsigned long)cycles, (unsigned long)(period_us / 1000), (unsigned long)misses);
+  printf("  %10s %10s %10s\n", "up to us", "period", "exec");
+  for (int i = 0; i < BUCKETS; i++) {
+    if (period_counts[i] == 0 && exec_counts[i] == 0) continue;
+    if (i < BUCKETS - 1)
+      printf("  %10lu %10lu %10lu\n", (unsigned long)BUCKET_EDGES[i], (unsigned long)period_counts[i], (unsigned long)exec_counts[i]);
+    else
+      printf("  %10s %10lu %10lu\n", "more", (unsigned long)period_counts[i], (unsigned long)exec_counts[i]);
+  }
+  printf("  %10s %10lu %10lu\n", "max", (unsigned long)period_max, (unsigned long)exec_max);
+}
+
+void TaskProfile::screen_print() {
+  char text[160];
+  snprintf(text, sizeof(text),
+           "%s  %lu cycles\n"
+           "period ms p50 %.1f p99 %.1f max %.1f\n"
+           "exec ms   p50 %.2f p99 %.2f max %.2f\n"
+           "missed %lu of %lu ms deadlines",
+           name, (unsigned long)cycles, period_percentile_get(0.5) / 1000.0, period_percentile_get(0.99) / 1000.0, period_max / 1000.0,
+           exec_percentile_get(0.5) / 1000.0, exec_percentile_get(0.99) / 1000.0, exec_max / 1000.0, (unsigned long)misses,
+           (unsigned long)(period_us / 1000));
+  ez::screen_print(text, 0);
+}
+
+TaskProfile* Profiler::add(const char* name, int period_ms) {
+  add_mutex.take();
+  int count = profile_count.load(std::memory_order_relaxed);
+  for (int i = 0; i < count; i++) {
+    if (!strcmp(profiles[i].name, name)) {
+      add_mutex.give();
+      return &profiles[i];
+    }
+  }
+  if (count == MAX_TASKS) {
+    add_mutex.give();
+    printf("Too many profiled tasks (%d), not timing %s\n", MAX_TASKS, name);
+    return nullptr;
+  }
+  TaskProfile& profile = profiles[count];
+  profile.name = name;
+  profile.period_us = period_ms * 1000;
+  profile_count.store(count + 1, std::memory_order_release);
+  add_mutex.give();
+  return &profile;
+}
+
+static void screen_next_callback() { profiler.screen_next(); }
+
+void Profiler::toggle(bool input) {
+  if (TaskProfile::active.exchange(input) == input) return;
+  // The auton selector has the left and right buttons
+  pros::lcd::register_btn1_cb(input ? screen_next_callback : screen_button);
+}
+
+void Profiler::screen_button_set(void (*callback)()) {
+  screen_button = callback;
+  if (!TaskProfile::active) pros::lcd::register_btn1_cb(callback);
+}
+
+bool Profiler::enabled() { return TaskProfile::active; }
+
+void Profiler::reset() {
+  int count = profile_count.load(std::memory_order_acquire);
+  for (int i = 0; i < count; i++) profiles[i].reset();
+}
+
+void Profiler::print() {
+  int count = profile_count.load(std::memory_order_acquire);
+  for (int i = 0; i < count; i++) profiles[i].print();
+}
+
+void Profiler::screen_next() {
+  int count = profile_count.load(std::memory_order_acquire);
+  if (count == 0) return;
+  screen_task = (screen_task + 1) % count;
+  profiles[screen_task].screen_print();
+  profiles[screen_task].print();
+}
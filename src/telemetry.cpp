@@ -0,0 +1,170 @@
+#include "telemetry.hpp"
+
+#include <cstdio>
+
+#include "main.h"
+#include "pros/apix.h"
+#include "telemetry_frame.hpp"
+
+Telemetry telemetry;
+
+static_assert(sizeof(Telemetry::Record) == 40, "Telemetry::Record is written to the SD card as is");
+
+// One SD card write, about 4KB of whole records
+static Telemetry::Record block[4096 / sizeof(Telemetry::Record)];
+static std::size_t block_count = 0;
+static FILE* file = nullptr;
+
+// Serial stream, and one drain's worth of encoded frames so each drain is one write
+static FILE* serial_file = nullptr;
+static std::uint8_t serial_buffer[64 * TELEMETRY_FRAME_ENCODED_MAX];
+static std::size_t serial_count = 0;
+
+// First free /usd/tlmNNN.bin, so every boot gets its own file
+static FILE* file_open() {
+  char name[32];
+  for (int i = 0; i < 1000; i++) {
+    snprintf(name, sizeof(name), "/usd/tlm%03d.bin", i);
+    FILE* existing = fopen(name, "rb");
+    if (existing) {
+      fclose(existing);
+      continue;
+    }
+    printf("Telemetry: writing %s\n", name);
+    return fopen(name, "wb");
+  }
+  return nullptr;
+}
+
+void Telemetry::initialize() {
+  if (active || !ez::util::SD_CARD_ACTIVE) return;
+  file = file_open();
+  if (!file) {
+    printf("Telemetry: couldn't open a file on the SD card\n");
+    return;
+  }
+
+  std::uint16_t header[4] = {0x5a45, 0x4c54, VERSION, sizeof(Record)};  // "EZTL" little endian
+  fwrite(header, sizeof(header), 1, file);
+  writer_start();
+}
+
+void Telemetry::writer_start() {
+  if (active) return;
+  active = true;
+  pros::c::task_create(writer_task, this, TASK_PRIORITY_MIN + 1, TASK_STACK_DEPTH_DEFAULT, "Telemetry");
+}
+
+bool Telemetry::enabled() { return active; }
+
+void Telemetry::serial_enable(bool input) {
+  if (input && !serial_file) {
+    // Its own stream id, so frames don't mix with printf on sout
+    serial_file = fopen("/ser/eztl", "wb");
+    if (!serial_file) {
+      printf("Telemetry: couldn't open the serial stream\n");
+      return;
+    }
+    pros::c::serctl(SERCTL_ACTIVATE, (void*)0x6c747a65);  // "eztl" little endian
+    pros::c::fdctl(fileno(serial_file), SERCTL_NOBLKWRITE, nullptr);
+  }
+  serial = input;
+  if (input) writer_start();
+}
+
+bool Telemetry::serial_enabled() { return serial; }
+
+void Telemetry::record(Ring& ring, Source source, std::uint8_t mode, const float (&values)[8]) {
+  if (!active) return;
+  Record r;
+  r.time = pros::c::millis();
+  r.source = source;
+  r.mode = mode;
+  r.seq = seq[source].fetch_add(1, std::memory_order_relaxed);
+  for (int i = 0; i < 8; i++) r.values[i] = values[i];
+  ring.push(r);
+}
+
+void Telemetry::drive_record() {
+  if (!active) return;
+  ez::pose pose = chassis.odom_pose_get();
+  float values[8] = {(float)chassis.leftPID.error, (float)chassis.rightPID.error, (float)chassis.headingPID.error,
+                     (float)chassis.turnPID.error, (float)chassis.swingPID.error, (float)pose.x, (float)pose.y, (float)pose.theta};
+  record(drive_ring, DRIVE, chassis.drive_mode_get(), values);
+}
+
+void Telemetry::control_record() {
+  if (!active) return;
+  const SensorFrame& frame = sensors.latest();
+  float values[8] = {(float)frame.heading, (float)frame.gyro_z, (float)climbHold.pid.error, (float)climbHold.output_get(),
+                     frame.left_velocity, frame.right_velocity, (float)frame.left_current, (float)frame.right_current};
+  record(control_ring, CONTROL, climbHold.lock_get(), values);
+}
+
+void Telemetry::input_record() {
+  if (!active) return;
+  const ControllerFrame& frame = inputs.latest();
+  float values[8] = {(float)frame.pressed, (float)frame.analog[0], (float)frame.analog[1], (float)frame.analog[2], (float)frame.analog[3]};
+  record(control_ring, INPUTS, 0, values);
+}
+
+void Telemetry::exit_record(std::uint8_t mode, int first_exit, int second_exit, double first_error, double second_error) {
+  if (!active) return;
+  float values[8] = {(float)first_exit, (float)second_exit, (float)first_error, (float)second_error};
+  record(event_ring, EXIT, mode, values);
+}
+
+std::uint32_t Telemetry::written_get() { return written; }
+
+std::uint32_t Telemetry::dropped_get() { return drive_ring.dropped_get() + control_ring.dropped_get() + event_ring.dropped_get(); }
+
+static std::uint32_t last_write = 0;
+
+static void serial_write() {
+  fwrite(serial_buffer, 1, serial_count, serial_file);
+  serial_count = 0;
+}
+
+static void block_write() {
+  fwrite(block, sizeof(Telemetry::Record), block_count, file);
+  fflush(file);
+  block_count = 0;
+  last_write = pros::c::millis();
+}
+
+// Moves every ring into the SD card block and the serial buffer.  The block is written every
+// time it fills up, or after a second so turning the robot off loses at most that much
+void Telemetry::drain() {
+  constexpr int BATCH = 32;
+  Record batch[BATCH];
+  Ring* rings[] = {&drive_ring, &control_ring, &event_ring};
+  for (Ring* ring : rings) {
+    while (std::size_t count = ring->pop(batch, BATCH)) {
+      written += count;
+      for (std::size_t i = 0; i < count; i++) {
+        if (file) {
+          block[block_count++] = batch[i];
+          if (block_count == sizeof(block) / sizeof(block[0])) block_write();
+        }
+        if (serial) {
+          if (serial_count + TELEMETRY_FRAME_ENCODED_MAX > sizeof(serial_buffer)) serial_write();
+          serial_count += telemetry_frame_encode(batch[i], serial_buffer + serial_count);
+        }
+      }
+    }
+  }
+  if (file && block_count > 0 && pros::c::millis() - last_write >= 1000) block_write();
+  if (serial && serial_count > 0) serial_write();
+}
+
+void Telemetry::writer_task(void* parameter) {
+  Telemetry* self = static_cast<Telemetry*>(parameter);
+  TaskProfile* profile = profiler.add("telemetry", 20);
+  while (true) {
+    {
+      TaskProfile::Scope cycle(profile);
+      self->drain();
+    }
+    pros::c::delay(20);
+  }
+}
@@ -0,0 +1,64 @@
+#include "telemetry_frame.hpp"
+
+#include <cstring>
+
+#include "crc16.hpp"
+
+std::size_t cobs_encode(const std::uint8_t* input, std::size_t size, std::uint8_t* output) {
+  std::size_t code_index = 0;
+  std::size_t out = 1;
+  std::uint8_t code = 1;
+  for (std::size_t i = 0; i < size; i++) {
+    if (input[i] != 0) {
+      output[out++] = input[i];
+      code++;
+    }
+    // A zero, or a full run of 254 bytes, closes the block
+    if (input[i] == 0 || code == 0xff) {
+      output[code_index] = code;
+      code_index = out++;
+      code = 1;
+    }
+  }
+  output[code_index] = code;
+  return out;
+}
+
+std::size_t cobs_decode(const std::uint8_t* input, std::size_t size, std::uint8_t* output) {
+  std::size_t in = 0;
+  std::size_t out = 0;
+  while (in < size) {
+    std::uint8_t code = input[in++];
+    if (code == 0 || in + code - 1 > size) return 0;
+    for (int i = 1; i < code; i++) {
+      if (input[in] == 0) return 0;
+      output[out++] = input[in++];
+    }
+    if (code != 0xff && in < size) output[out++] = 0;
+  }
+  return out;
+}
+
+std::size_t telemetry_frame_encode(const Telemetry::Record& record, std::uint8_t* output) {
+  std::uint8_t frame[TELEMETRY_FRAME_SIZE];
+  frame[0] = TELEMETRY_FRAME_VERSION;
+  std::memcpy(frame + 1, &record, sizeof(record));
+  std::uint16_t crc = crc16(frame, TELEMETRY_FRAME_SIZE - 2);
+  frame[TELEMETRY_FRAME_SIZE - 2] = crc & 0xff;
+  frame[TELEMETRY_FRAME_SIZE - 1] = crc >> 8;
+
+  std::size_t size = cobs_encode(frame, sizeof(frame), output);
+  output[size++] = 0;
+  return size;
+}
+
+bool telemetry_frame_decode(const std::uint8_t* frame, std::size_t size, Telemetry::Record& record) {
+  std::uint8_t decoded[TELEMETRY_FRAME_ENCODED_MAX];
+  if (size > sizeof(decoded)) return false;
+  if (cobs_decode(frame, size, decoded) != TELEMETRY_FRAME_SIZE) return false;
+  if (decoded[0] != TELEMETRY_FRAME_VERSION) return false;
+  std::uint16_t crc = decoded[TELEMETRY_FRAME_SIZE - 2] | decoded[TELEMETRY_FRAME_SIZE - 1] << 8;
+  if (crc16(decoded, TELEMETRY_FRAME_SIZE - 2) != crc) return false;
+  std::memcpy(&record, decoded + 1, sizeof(record));
+  return true;
+}
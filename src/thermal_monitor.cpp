@@ -0,0 +1,158 @@
+#include "thermal_monitor.hpp"
+
+#include <cmath>
+
+#include "main.h"
+
+ThermalMonitor thermal;
+
+namespace {
+// V5 motors report temperature in 5C steps
+constexpr double REPORT_STEP = 5.0;
+
+// Seconds the current draw is averaged over, long enough to see through a single motion
+constexpr double CURRENT_WINDOW = 3.0;
+}  // namespace
+
+void ThermalMonitor::task_function(void* parameter) {
+  ThermalMonitor* monitor = static_cast<ThermalMonitor*>(parameter);
+  std::uint32_t now = pros::c::millis();
+  while (true) {
+    monitor->step();
+    pros::c::task_delay_until(&now, SAMPLE_MS);
+  }
+}
+
+void ThermalMonitor::initialize() {
+  if (started) return;
+  motor_count = 0;
+  for (auto& motor : chassis.left_motors)
+    if (motor_count < MAX_MOTORS) motors[motor_count++] = &motor;
+  for (auto& motor : chassis.right_motors)
+    if (motor_count < MAX_MOTORS) motors[motor_count++] = &motor;
+  drive_count = motor_count;
+  for (const pros::Motor* motor : {&Intake1, &Intake2})
+    if (motor_count < MAX_MOTORS) motors[motor_count++] = motor;
+
+  for (int i = 0; i < motor_count; i++) {
+    double reported = motors[i]->get_temperature();
+    if (!std::isfinite(reported)) reported = 25.0;
+    ambient[i] = reported;
+    temperature[i] = reported;
+    current_squared[i] = 0;
+    derate[i] = INFINITY;
+  }
+  last_time = pros::millis();
+  started = true;
+  pros::c::task_create(task_function, this, TASK_PRIORITY_MIN + 1, TASK_STACK_DEPTH_DEFAULT, "Thermal");
+}
+
+void ThermalMonitor::model_set(double p_heating, double p_time_constant) {
+  heating = fabs(p_heating);
+  time_constant = fmax(fabs(p_time_constant), 1.0);
+}
+
+double ThermalMonitor::temperature_get(int motor) { return motor >= 0 && motor < motor_count ? temperature[motor] : 0.0; }
+
+double ThermalMonitor::derate_time_get(int motor) { return motor >= 0 && motor < motor_count ? derate[motor] : INFINITY; }
+
+double ThermalMonitor::drive_derate_time_get() {
+  double soonest = INFINITY;
+  for (int i = 0; i < drive_count; i++) soonest = fmin(soonest, derate[i]);
+  return soonest;
+}
+
+double ThermalMonitor::intake_derate_time_get() {
+  double soonest = INFINITY;
+  for (int i = drive_count; i < motor_count; i++) soonest = fmin(soonest, derate[i]);
+  return soonest;
+}
+
+void ThermalMonitor::speed_horizon_set(double seconds, double p_min_scale) {
+  horizon = fmax(fabs(seconds), 1.0);
+  min_scale = util::clamp(p_min_scale, 1.0, 0.0);
+}
+
+double ThermalMonitor::drive_speed_scale_get() { return drive_scale; }
+
+int ThermalMonitor::drive_speed(int speed) { return lround(speed * drive_speed_scale_get()); }
+
+void ThermalMonitor::drive_limit_toggle(bool input) { drive_limit = input; }
+
+bool ThermalMonitor::drive_limit_enabled() { return drive_limit; }
+
+// Holding the averaged current, the model heads for T_ss = ambient + heating * I^2 * time_constant
+// and gets to DERATE_TEMPERATURE at t = -time_constant * ln((DERATE - T_ss) / (T - T_ss))
+double ThermalMonitor::derate_time(int motor) {
+  double now = temperature[motor];
+  if (now >= DERATE_TEMPERATURE) return 0.0;
+  double steady = ambient[motor] + heating * current_squared[motor] * time_constant;
+  if (steady <= DERATE_TEMPERATURE) return INFINITY;
+  return -time_constant * log((DERATE_TEMPERATURE - steady) / (now - steady));
+}
+
+// Caps the running motion.  Its slew was set up with the old max speed and clips to it once it's
+// done ramping, so that gets the new one too.  A slew that's still ramping picks it up next time
+static void motion_speed_set(int speed) {
+  chassis.pid_speed_max_set(speed);
+  switch (chassis.drive_mode_get()) {
+    case ez::DRIVE:
+      if (!chassis.slew_left.enabled()) chassis.slew_left.initialize(false, speed, chassis.leftPID.target_get(), chassis.drive_sensor_left());
+      if (!chassis.slew_right.enabled()) chassis.slew_right.initialize(false, speed, chassis.rightPID.target_get(), chassis.drive_sensor_right());
+      break;
+    case ez::TURN:
+      if (!chassis.slew_turn.enabled()) chassis.slew_turn.initialize(false, speed, chassis.turnPID.target_get(), chassis.drive_imu_get());
+      break;
+    case ez::SWING:
+      if (!chassis.slew_swing.enabled()) chassis.slew_swing.initialize(false, speed, chassis.swingPID.target_get(), chassis.drive_imu_get());
+      break;
+    default:
+      break;
+  }
+}
+
+void ThermalMonitor::step() {
+  std::uint32_t now = pros::millis();
+  double dt = (now - last_time) / 1000.0;
+  last_time = now;
+  double alpha = dt / (dt + CURRENT_WINDOW);
+
+  for (int i = 0; i < motor_count; i++) {
+    double amps = motors[i]->get_current_draw() / 1000.0;
+    double reported = motors[i]->get_temperature();
+    if (std::isfinite(reported) && amps >= 0) {
+      current_squared[i] += (amps * amps - current_squared[i]) * alpha;
+      temperature[i] += dt * (heating * amps * amps - (temperature[i] - ambient[i]) / time_constant);
+      // The reading is only good to half a step, inside that the model knows better
+      temperature[i] = util::clamp(temperature[i], reported + REPORT_STEP / 2.0, reported - REPORT_STEP / 2.0);
+    }
+    derate[i] = derate_time(i);
+  }
+
+  double seconds = drive_derate_time_get();
+  drive_scale = seconds >= horizon ? 1.0 : min_scale + (1.0 - min_scale) * seconds / horizon;
+}
+
+void ThermalMonitor::drive_limit_step() {
+  if (!drive_limit) return;
+  if (chassis.drive_mode_get() == ez::DISABLE) {
+    speed_scaled = -1;
+    return;
+  }
+  // A new motion set its own speed since the last step
+  int speed = chassis.pid_speed_max_get();
+  if (speed != speed_scaled) speed_unscaled = speed;
+  speed_scaled = drive_speed(speed_unscaled);
+  if (speed_scaled != speed) motion_speed_set(speed_scaled);
+}
+
+void ThermalMonitor::print() {
+  printf("Thermal: motor, model C, derate in s\n");
+  for (int i = 0; i < motor_count; i++) {
+    printf("  %-7s %2d  %5.1f  ", i < drive_count ? "drive" : "intake", i, temperature[i]);
+    if (std::isinf(derate[i]))
+      printf("never\n");
+    else
+      printf("%.0f\n", derate[i]);
+  }
+}
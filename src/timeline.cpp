@@ -0,0 +1,97 @@
+#include "timeline.hpp"
+
+#include "main.h"
+
+Timeline timeline;
+
+void Timeline::record(const char* name, Kind kind) {
+  std::uint64_t time = pros::c::micros();
+  std::uint32_t current = phase.load(std::memory_order_acquire);
+  int index = count.fetch_add(1, std::memory_order_relaxed);
+  if (index >= MAX_EVENTS) {
+    count.store(MAX_EVENTS, std::memory_order_relaxed);
+    dropped++;
+    return;
+  }
+  events[index] = {time, name, kind};
+  written[index].store(current, std::memory_order_release);
+}
+
+void Timeline::phase_begin(const char* name) {
+  clear();
+  phase_name = name;
+  record(name, PHASE);
+  tick_armed = true;
+  output_armed = true;
+}
+
+void Timeline::begin(const char* name) { record(name, BEGIN); }
+
+void Timeline::end(const char* name) { record(name, END); }
+
+void Timeline::mark(const char* name) { record(name, MARK); }
+
+void Timeline::tick() {
+  if (tick_armed.load(std::memory_order_relaxed) && tick_armed.exchange(false)) record("first tick", MARK);
+}
+
+void Timeline::output_check(ez::Drive& drive) {
+  if (!output_armed.load(std::memory_order_relaxed)) return;
+  // The voltage the motor reports, so this is when the command landed and not when it was sent
+  for (auto* side : {&drive.left_motors, &drive.right_motors}) {
+    if (side->empty() || side->front().get_voltage() == 0) continue;
+    if (output_armed.exchange(false)) record("first output", MARK);
+    return;
+  }
+}
+
+int Timeline::size() {
+  int size = count.load(std::memory_order_relaxed);
+  return size < MAX_EVENTS ? size : MAX_EVENTS;
+}
+
+Timeline::Event Timeline::event_get(int index) {
+  if (index < 0 || index >= size() || written[index].load(std::memory_order_acquire) != phase.load(std::memory_order_acquire)) return {0, "", MARK};
+  return events[index];
+}
+
+std::uint32_t Timeline::dropped_get() { return dropped; }
+
+void Timeline::clear() {
+  count = 0;
+  dropped = 0;
+  // After the count, so a mark that takes a slot from the new count is tagged with the new phase
+  phase++;
+}
+
+void Timeline::write(FILE* file) {
+  static const char* KIND_NAMES[] = {"phase", "begin", "end", "mark"};
+  fprintf(file, "Timeline: ms since boot, ms since the phase started\n");
+  std::uint64_t phase_start = 0;
+  for (int i = 0; i < size(); i++) {
+    Event event = event_get(i);
+    if (!event.name[0]) continue;  // a mark from the last phase took the slot
+    if (event.kind == PHASE) phase_start = event.time;
+    fprintf(file, "  %9.3f  %9.3f  %-5s %s\n", event.time / 1000.0, (event.time - phase_start) / 1000.0, KIND_NAMES[event.kind], event.name);
+  }
+  if (dropped) fprintf(file, "  %lu events didn't fit\n", (unsigned long)dropped.load());
+}
+
+void Timeline::print() { write(stdout); }
+
+bool Timeline::save(const char* path) {
+  if (!ez::util::SD_CARD_ACTIVE) return false;
+  char phase_path[48];
+  if (!path) {
+    snprintf(phase_path, sizeof(phase_path), "/usd/timeline_%s.txt", phase_name.load());
+    path = phase_path;
+  }
+  FILE* file = fopen(path, "w");
+  if (!file) {
+    printf("Timeline: couldn't open %s\n", path);
+    return false;
+  }
+  write(file);
+  fclose(file);
+  return true;
+}